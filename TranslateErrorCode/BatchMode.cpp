@@ -0,0 +1,941 @@
+﻿/*+===================================================================
+  File:      BatchMode.cpp
+
+  Summary:   Command line batch mode. Translates error codes (one per line)
+             from a file or stdin and writes one result line per code as
+             TSV or JSON to stdout. No window is created in this mode.
+
+             Usage:
+             TranslateErrorCode.exe /batch [file] [/format:tsv|json] [/threads:N] [/sources:wu,ntstatus,...] [/stats]
+             TranslateErrorCode.exe /buildsnapshot [file]
+             TranslateErrorCode.exe /compiledb input.tsv output.tecdb
+             TranslateErrorCode.exe /scan [file] (see LogScanner.cpp)
+             TranslateErrorCode.exe /list [/range:first-last] [/facility:N] (see CodeListing.cpp)
+             TranslateErrorCode.exe /export:csv|ndjson (see CodeListing.cpp)
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "BatchMode.h"
+#include "TranslateEngine.h"
+#include "MessageSnapshot.h"
+#include "CodeDatabase.h"
+#include "WorkStealingPool.h"
+#include "LogScanner.h"
+#include "CodeListing.h"
+#include "CodeParser.h"
+#include <shlwapi.h>
+
+// Lines per work item in the parallel batch mode
+#define BATCHCHUNKLINES 2048
+
+// Max work items per thread in progress or waiting for output
+#define BATCHCHUNKSPERTHREAD 4
+
+// Output formats
+enum BatchFormat {
+    FORMAT_TSV,
+    FORMAT_JSON
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchReader::readByte
+
+  Summary:  Get next byte from input
+
+  Args:     BYTE& byte
+              Receives the byte
+
+  Returns:  bool
+              true = Byte read
+              false = End of input
+
+-----------------------------------------------------------------F-F*/
+bool BatchReader::readByte(BYTE& byte) {
+    if (m_dwPos >= m_dwLength) {
+        if (m_bEOF) return false;
+        m_dwPos = 0;
+        if (!ReadFile(m_hInput, m_buffer, sizeof(m_buffer), &m_dwLength, NULL) || (m_dwLength == 0)) { // Error, broken pipe or end of file
+            m_dwLength = 0;
+            m_bEOF = true;
+            return false;
+        }
+        if (m_bStart) { // Check byte order mark
+            m_bStart = false;
+            if ((m_dwLength >= 2) && (m_buffer[0] == 0xFF) && (m_buffer[1] == 0xFE)) {
+                m_bUTF16 = true;
+                m_dwPos = 2;
+            } else if ((m_dwLength >= 3) && (m_buffer[0] == 0xEF) && (m_buffer[1] == 0xBB) && (m_buffer[2] == 0xBF)) {
+                m_dwPos = 3;
+            }
+            if (m_dwPos >= m_dwLength) return readByte(byte);
+        }
+    }
+    byte = m_buffer[m_dwPos++];
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchReader::readLine
+
+  Summary:  Get next line from input (without line break)
+
+  Args:     std::wstring& sLine
+              Receives the line
+
+  Returns:  bool
+              true = Line read
+              false = End of input
+
+-----------------------------------------------------------------F-F*/
+bool BatchReader::readLine(std::wstring& sLine) {
+    BYTE byte;
+    bool bData = false;
+    sLine.clear();
+    m_sLineBytes.clear();
+    while (readByte(byte)) {
+        bData = true;
+        if (m_bUTF16) {
+            BYTE byteHigh = 0;
+            readByte(byteHigh);
+            wchar_t ch = (wchar_t)(byte | (byteHigh << 8));
+            if (ch == L'\n') break;
+            sLine.push_back(ch);
+        } else {
+            if (byte == '\n') break;
+            m_sLineBytes.push_back((char)byte);
+        }
+    }
+    if (!m_bUTF16 && !m_sLineBytes.empty()) { // Convert UTF-8 line
+        int cch = MultiByteToWideChar(CP_UTF8, 0, m_sLineBytes.data(), (int)m_sLineBytes.size(), NULL, 0);
+        if (cch > 0) {
+            sLine.resize(cch);
+            MultiByteToWideChar(CP_UTF8, 0, m_sLineBytes.data(), (int)m_sLineBytes.size(), &sLine[0], cch);
+        }
+    }
+    if (!sLine.empty() && (sLine.back() == L'\r')) sLine.pop_back();
+    return bData;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::BatchWriter
+
+  Summary:  Constructor
+
+  Args:     HANDLE hOutput
+              Handle for output (console, file or pipe)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+BatchWriter::BatchWriter(HANDLE hOutput) : m_hOutput(hOutput) {
+    DWORD dwMode;
+    m_bConsole = (hOutput != NULL) && (GetConsoleMode(hOutput, &dwMode) != 0);
+    m_sBuffer.reserve(BATCHBUFFERSIZE);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::write
+
+  Summary:  Append text to output buffer
+
+  Args:     const wchar_t* pText
+              Text
+            size_t length
+              Length of text in chars
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchWriter::write(const wchar_t* pText, size_t length) {
+    m_sBuffer.append(pText, length);
+    if (m_sBuffer.size() >= BATCHBUFFERSIZE) flush();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::writeTsvEscaped
+
+  Summary:  Append text with escaped tabs, line breaks and backslashes
+
+  Args:     const wchar_t* szText
+              Text
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchWriter::writeTsvEscaped(const wchar_t* szText) {
+    for (const wchar_t* p = szText; *p != L'\0'; p++) {
+        switch (*p) {
+            case L'\t': m_sBuffer.append(L"\\t"); break;
+            case L'\r': m_sBuffer.append(L"\\r"); break;
+            case L'\n': m_sBuffer.append(L"\\n"); break;
+            case L'\\': m_sBuffer.append(L"\\\\"); break;
+            default: m_sBuffer.push_back(*p);
+        }
+    }
+    if (m_sBuffer.size() >= BATCHBUFFERSIZE) flush();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::writeJsonEscaped
+
+  Summary:  Append text as content of a JSON string
+
+  Args:     const wchar_t* szText
+              Text
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchWriter::writeJsonEscaped(const wchar_t* szText) {
+    for (const wchar_t* p = szText; *p != L'\0'; p++) {
+        switch (*p) {
+            case L'"': m_sBuffer.append(L"\\\""); break;
+            case L'\\': m_sBuffer.append(L"\\\\"); break;
+            case L'\t': m_sBuffer.append(L"\\t"); break;
+            case L'\r': m_sBuffer.append(L"\\r"); break;
+            case L'\n': m_sBuffer.append(L"\\n"); break;
+            default:
+                if (*p < L' ') { // Other control chars
+                    wchar_t szEscape[7];
+                    _snwprintf_s(szEscape, _countof(szEscape), _TRUNCATE, L"\\u%04X", *p);
+                    m_sBuffer.append(szEscape);
+                } else m_sBuffer.push_back(*p);
+        }
+    }
+    if (m_sBuffer.size() >= BATCHBUFFERSIZE) flush();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::writeCsvEscaped
+
+  Summary:  Append text as quoted CSV field (RFC 4180, quotes are doubled)
+
+  Args:     const wchar_t* szText
+              Text
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchWriter::writeCsvEscaped(const wchar_t* szText) {
+    m_sBuffer.push_back(L'"');
+    for (const wchar_t* p = szText; *p != L'\0'; p++) {
+        if (*p == L'"') m_sBuffer.push_back(L'"');
+        m_sBuffer.push_back(*p);
+    }
+    m_sBuffer.push_back(L'"');
+    if (m_sBuffer.size() >= BATCHBUFFERSIZE) flush();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchWriter::flush
+
+  Summary:  Write buffered text to output (nothing to do for a memory
+            writer). A failed write is recorded for failed(), the text is
+            discarded.
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchWriter::flush() {
+    if (m_sBuffer.empty() || (m_hOutput == NULL)) return;
+    DWORD dwWritten = 0;
+    if (m_bConsole) {
+        if (!WriteConsole(m_hOutput, m_sBuffer.data(), (DWORD)m_sBuffer.size(), &dwWritten, NULL) || (dwWritten != m_sBuffer.size())) m_bFailed = true;
+    } else {
+        int cb = WideCharToMultiByte(CP_UTF8, 0, m_sBuffer.data(), (int)m_sBuffer.size(), NULL, 0, NULL, NULL);
+        if (cb > 0) {
+            m_sUTF8.resize(cb);
+            WideCharToMultiByte(CP_UTF8, 0, m_sBuffer.data(), (int)m_sBuffer.size(), &m_sUTF8[0], cb, NULL, NULL);
+            if (!WriteFile(m_hOutput, m_sUTF8.data(), (DWORD)cb, &dwWritten, NULL) || (dwWritten != (DWORD)cb)) m_bFailed = true;
+        } else m_bFailed = true;
+    }
+    m_sBuffer.clear();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getBatchStdHandle
+
+  Summary:  Get standard handle. When the program was started without
+            redirection, the console of the parent process is used. The
+            console handle is opened once and set as standard handle, so
+            later calls return it without a new handle.
+
+  Args:     DWORD nStdHandle
+              STD_INPUT_HANDLE, STD_OUTPUT_HANDLE or STD_ERROR_HANDLE
+
+  Returns:  HANDLE
+              Handle or INVALID_HANDLE_VALUE
+
+-----------------------------------------------------------------F-F*/
+HANDLE getBatchStdHandle(DWORD nStdHandle) {
+    HANDLE hStd = GetStdHandle(nStdHandle);
+    if ((hStd != NULL) && (hStd != INVALID_HANDLE_VALUE)) return hStd;
+
+    AttachConsole(ATTACH_PARENT_PROCESS); // Fails, if already attached or no parent console exists
+    hStd = CreateFile((nStdHandle == STD_INPUT_HANDLE) ? L"CONIN$" : L"CONOUT$",
+        GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
+    if (hStd != INVALID_HANDLE_VALUE) SetStdHandle(nStdHandle, hStd); // Used until the program ends
+    return hStd;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isOption
+
+  Summary:  Check, if a command line argument is the option /name or -name
+
+  Args:     LPCWSTR szArg
+              Command line argument
+            LPCWSTR szName
+              Option name
+            LPCWSTR* pszValue
+              Receives the value for /name:value (optional)
+
+  Returns:  bool
+
+-----------------------------------------------------------------F-F*/
+bool isOption(LPCWSTR szArg, LPCWSTR szName, LPCWSTR* pszValue) {
+    if ((szArg[0] != L'/') && (szArg[0] != L'-')) return false;
+    size_t length = wcslen(szName);
+    if (_wcsnicmp(szArg + 1, szName, length) != 0) return false;
+    if (szArg[length + 1] == L'\0') {
+        if (pszValue != NULL) *pszValue = L"";
+        return true;
+    }
+    if ((szArg[length + 1] == L':') && (pszValue != NULL)) {
+        *pszValue = szArg + length + 2;
+        return true;
+    }
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isBatchModeCommandLine
+
+  Summary:  Check, if the program was started in batch mode
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  bool
+
+-----------------------------------------------------------------F-F*/
+bool isBatchModeCommandLine(int argc, LPWSTR* argv) {
+    LPCWSTR szValue;
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"batch") || isOption(argv[i], L"buildsnapshot") || isOption(argv[i], L"compiledb") || isOption(argv[i], L"scan") || isOption(argv[i], L"list") || isOption(argv[i], L"export", &szValue)) return true;
+    }
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: writeBatchResult
+
+  Summary:  Write result line for one input line
+
+  Args:     BatchWriter& writer
+              Output
+            BatchFormat format
+              TSV or JSON
+            const std::wstring& sInput
+              Input line
+            const wchar_t* szError
+              NULL = Input is a valid error code, otherwise reason
+            DWORD dwCode
+              Error code
+            const ResultListSink& results
+              Texts for the error code
+            const TranslateEngine& engine
+              Engine with the languages of the TSV columns
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void writeBatchResult(BatchWriter& writer, BatchFormat format, const std::wstring& sInput, const wchar_t* szError, DWORD dwCode, const ResultListSink& results, const TranslateEngine& engine) {
+    wchar_t szNumber[40];
+    wchar_t szTag[LANGUAGETAGSIZE];
+    if (format == FORMAT_JSON) {
+        writer.write(L"{\"input\":\"");
+        writer.writeJsonEscaped(sInput.c_str());
+        if (szError != NULL) {
+            writer.write(L"\",\"error\":\"");
+            writer.writeJsonEscaped(szError);
+            writer.write(L"\"}\n");
+            return;
+        }
+        _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"\",\"code\":\"0x%08X\",\"dword\":%u,\"int\":%d,\"texts\":[", dwCode, dwCode, (int)dwCode);
+        writer.write(szNumber);
+        for (size_t i = 0; i < results.count; i++) {
+            writer.write((i == 0) ? L"{\"source\":\"" : L",{\"source\":\"");
+            writer.writeJsonEscaped(getSourceName(results.results[i].source));
+            if (getLanguageTag(results.results[i].langId, szTag) > 0) {
+                writer.write(L"\",\"lang\":\"");
+                writer.writeJsonEscaped(szTag);
+            }
+            writer.write(L"\",\"text\":\"");
+            writer.writeJsonEscaped(results.results[i].szText);
+            writer.write(L"\"}");
+        }
+        writer.write(L"]}\n");
+    } else {
+        writer.writeTsvEscaped(sInput.c_str());
+        writer.write(L"\t");
+        if (szError == NULL) {
+            _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"0x%08X", dwCode);
+            writer.write(szNumber);
+        }
+        // One column per selected source (Win32/HRESULT and NTSTATUS: per language)
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            if ((engine.sources() & SOURCEBIT(source)) == 0) continue;
+            bool bLanguages = (source == SOURCE_WIN32) || (source == SOURCE_NTSTATUS);
+            size_t languageCount = bLanguages ? engine.languageCount() : 1;
+            for (size_t j = 0; j < languageCount; j++) {
+                writer.write(L"\t");
+                for (size_t i = 0; i < results.count; i++) {
+                    if ((results.results[i].source == source) && (!bLanguages || (results.results[i].langId == engine.language(j)))) writer.writeTsvEscaped(results.results[i].szText);
+                }
+            }
+        }
+        writer.write(L"\n");
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: translateBatchLine
+
+  Summary:  Translate one input line and write the result line
+
+  Args:     TranslateEngine& engine
+              Engine of the calling thread
+            ResultListSink& results
+              Buffer for the results
+            BatchWriter& writer
+              Output
+            BatchFormat format
+              TSV or JSON
+            std::wstring& sLine
+              Input line (is trimmed)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void translateBatchLine(TranslateEngine& engine, ResultListSink& results, BatchWriter& writer, BatchFormat format, std::wstring& sLine) {
+    // Trim spaces
+    size_t first = sLine.find_first_not_of(L" \t");
+    if (first == std::wstring::npos) return; // Ignore empty lines
+    sLine.erase(0, first);
+    sLine.erase(sLine.find_last_not_of(L" \t") + 1);
+
+    ParsedNumber number;
+    DWORD dwCode = 0;
+    const wchar_t* szError = NULL;
+    {
+        StageTimer timer(engine.stats(), STAGE_PARSE);
+        switch (parseNumber(sLine.c_str(), sLine.length(), &number)) {
+        case PARSE_OK:
+            if (!getErrorCode(number, &dwCode)) szError = L"error code out of range";
+            break;
+        case PARSE_OVERFLOW:
+            szError = L"error code out of range";
+            break;
+        default:
+            szError = L"invalid error code";
+        }
+    }
+    results.clear();
+    if (szError == NULL) engine.translate(dwCode, results);
+    StageTimer timer(engine.stats(), STAGE_OUTPUT);
+    writeBatchResult(writer, format, sLine, szError, dwCode, results, engine);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: writeBatchStats
+
+  Summary:  Write summary of the counters and stage timings (/stats)
+
+  Args:     BatchWriter& writer
+              Output (stderr)
+            const LookupStats& stats
+              Sum of the counters of all engines
+            ULONGLONG elapsedTicks
+              Duration of the batch run
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void writeBatchStats(BatchWriter& writer, const LookupStats& stats, ULONGLONG elapsedTicks) {
+    wchar_t szLine[200];
+    _snwprintf_s(szLine, _countof(szLine), _TRUNCATE, L"Lookups: %llu, results: %llu, elapsed: %llu us\n"
+        L"Index: %llu hits, %llu misses\nMessage cache: %llu hits, %llu misses\n",
+        stats.lookups, stats.results, ticksToMicroseconds(elapsedTicks),
+        stats.indexHits, stats.indexMisses, stats.cacheHits, stats.cacheMisses);
+    writer.write(szLine);
+    writer.write(L"Stage\tCalls\tTotal us\tAverage ns\n");
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        ULONGLONG total = ticksToMicroseconds(stats.stageTicks[i]);
+        ULONGLONG average = (stats.stageCalls[i] > 0) ? ticksToMicroseconds(stats.stageTicks[i] * 1000 / stats.stageCalls[i]) : 0;
+        _snwprintf_s(szLine, _countof(szLine), _TRUNCATE, L"%s\t%llu\t%llu\t%llu\n", getStageName((LookupStage)i), stats.stageCalls[i], total, average);
+        writer.write(szLine);
+    }
+}
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    BatchChunk
+
+  Summary:  Input lines and output text of one work item in the parallel
+            batch mode
+-----------------------------------------------------------------C-C*/
+class BatchChunk : public PoolTask {
+public:
+    BatchChunk(std::vector<TranslateEngine*>& engines, BatchFormat format, CONDITION_VARIABLE* pDone, SRWLOCK* pLock) :
+        m_engines(engines), m_format(format), m_pDone(pDone), m_pLock(pLock) {}
+    void run(size_t worker) override;
+    std::vector<std::wstring> lines;
+    std::wstring sOutput;
+    bool bDone = false; // Protected by *m_pLock
+private:
+    std::vector<TranslateEngine*>& m_engines;
+    BatchFormat m_format;
+    CONDITION_VARIABLE* m_pDone;
+    SRWLOCK* m_pLock;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: BatchChunk::run
+
+  Summary:  Translate all lines of the chunk (runs on a worker thread)
+
+  Args:     size_t worker
+              Index of the worker thread
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void BatchChunk::run(size_t worker) {
+    BatchWriter writer(NULL);
+    ResultListSink results;
+    writer.buffer().swap(sOutput);
+    for (std::wstring& sLine : lines) translateBatchLine(*m_engines[worker], results, writer, m_format, sLine);
+    writer.buffer().swap(sOutput);
+
+    AcquireSRWLockExclusive(m_pLock);
+    bDone = true;
+    ReleaseSRWLockExclusive(m_pLock);
+    WakeAllConditionVariable(m_pDone);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runParallelBatch
+
+  Summary:  Translate input with a thread pool. The input is split into
+            chunks, the results are written in input order.
+
+  Args:     BatchReader& reader
+              Input
+            BatchWriter& writer
+              Output
+            BatchFormat format
+              TSV or JSON
+            size_t threads
+              Number of worker threads
+            const LANGID* pLangIds
+              Languages for Win32/HRESULT and NTSTATUS
+            size_t languageCount
+              Number of languages (0 = DEFAULTLANGID)
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT)
+            LookupStats& stats
+              Receives the sum of the counters of all engines
+
+  Returns:  bool
+              true = success
+              false = Threads could not be started
+
+-----------------------------------------------------------------F-F*/
+bool runParallelBatch(BatchReader& reader, BatchWriter& writer, BatchFormat format, size_t threads, const LANGID* pLangIds, size_t languageCount, DWORD dwSources, LookupStats& stats) {
+    std::vector<TranslateEngine*> engines; // One engine per worker with own buffers and caches
+    for (size_t i = 0; i < threads; i++) {
+        engines.push_back(new TranslateEngine());
+        engines.back()->setLanguages(pLangIds, languageCount);
+        engines.back()->setSources(dwSources);
+    }
+    CONDITION_VARIABLE cvDone;
+    SRWLOCK lock;
+    InitializeConditionVariable(&cvDone);
+    InitializeSRWLock(&lock);
+
+    WorkStealingPool pool;
+    if (!pool.start(threads)) {
+        for (TranslateEngine* pEngine : engines) delete pEngine;
+        return false;
+    }
+
+    std::deque<BatchChunk*> pending; // Reorder buffer, chunks in input order
+    bool bEOF = false;
+    while (!bEOF || !pending.empty()) {
+        // Read and queue the next chunk
+        if (!bEOF && (pending.size() < threads * BATCHCHUNKSPERTHREAD)) {
+            BatchChunk* pChunk = new BatchChunk(engines, format, &cvDone, &lock);
+            pChunk->lines.resize(BATCHCHUNKLINES);
+            size_t count = 0;
+            while ((count < BATCHCHUNKLINES) && reader.readLine(pChunk->lines[count])) count++;
+            if (count < BATCHCHUNKLINES) bEOF = true;
+            if (count == 0) {
+                delete pChunk;
+                continue;
+            }
+            pChunk->lines.resize(count);
+            pending.push_back(pChunk);
+            pool.submit(pChunk);
+            continue;
+        }
+
+        // Write finished chunks in input order, wait for the oldest chunk, when the buffer is full
+        AcquireSRWLockExclusive(&lock);
+        while (!pending.front()->bDone) SleepConditionVariableSRW(&cvDone, &lock, INFINITE, 0);
+        ReleaseSRWLockExclusive(&lock);
+        for (;;) {
+            BatchChunk* pChunk = pending.front();
+            writer.write(pChunk->sOutput);
+            pending.pop_front();
+            delete pChunk;
+            if (pending.empty()) break;
+            AcquireSRWLockExclusive(&lock);
+            bool bDone = pending.front()->bDone;
+            ReleaseSRWLockExclusive(&lock);
+            if (!bDone) break;
+        }
+    }
+    pool.stop();
+    for (TranslateEngine* pEngine : engines) {
+        stats.add(pEngine->stats());
+        delete pEngine;
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runBuildSnapshot
+
+  Summary:  Create snapshot of all Win32/HRESULT and NTSTATUS messages
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments or snapshot could not be written
+
+-----------------------------------------------------------------F-F*/
+int runBuildSnapshot(int argc, LPWSTR* argv) {
+    BatchWriter writer(getBatchStdHandle(STD_OUTPUT_HANDLE));
+    wchar_t szDefaultFile[MAX_PATH];
+    LPCWSTR szFile = NULL;
+    bool bArgsOK = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"buildsnapshot")) continue;
+        if ((szFile == NULL) && (argv[i][0] != L'/')) {
+            szFile = argv[i];
+        } else bArgsOK = false;
+    }
+    if (!bArgsOK) {
+        writer.write(L"Usage: TranslateErrorCode.exe /buildsnapshot [file]\n"
+            L"Creates a snapshot of all Win32/HRESULT and NTSTATUS messages\n");
+        return 1;
+    }
+    if (szFile == NULL) {
+        if (!getDefaultSnapshotPath(szDefaultFile, MAX_PATH, true)) {
+            writer.write(L"Local application data folder not found\n");
+            return 1;
+        }
+        szFile = szDefaultFile;
+    }
+
+    DWORD dwWin32Count = 0;
+    DWORD dwNTStatusCount = 0;
+    if (!buildMessageSnapshot(szFile, &dwWin32Count, &dwNTStatusCount)) {
+        writer.write(L"Snapshot could not be written: ");
+        writer.write(szFile);
+        writer.write(L"\n");
+        return 1;
+    }
+    wchar_t szInfo[100];
+    _snwprintf_s(szInfo, _countof(szInfo), _TRUNCATE, L"%u Win32/HRESULT and %u NTSTATUS messages written to ", dwWin32Count, dwNTStatusCount);
+    writer.write(szInfo);
+    writer.write(szFile);
+    writer.write(L"\n");
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: unescapeTsv
+
+  Summary:  Replace the escape sequences \t, \r, \n and \\ in a TSV field
+
+  Args:     std::wstring& sText
+              Field
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void unescapeTsv(std::wstring& sText) {
+    size_t target = 0;
+    for (size_t i = 0; i < sText.size(); i++) {
+        wchar_t ch = sText[i];
+        if ((ch == L'\\') && (i + 1 < sText.size())) {
+            switch (sText[i + 1]) {
+                case L't': ch = L'\t'; i++; break;
+                case L'r': ch = L'\r'; i++; break;
+                case L'n': ch = L'\n'; i++; break;
+                case L'\\': i++; break;
+            }
+        }
+        sText[target++] = ch;
+    }
+    sText.resize(target);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runCompileDatabase
+
+  Summary:  Create code database from a TSV file with the lines
+            "Source<Tab>Code<Tab>Text". Source is WU, LDAP,
+            StopCode/BugCheck or Wininet.
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments, invalid input or database could not be written
+
+-----------------------------------------------------------------F-F*/
+int runCompileDatabase(int argc, LPWSTR* argv) {
+    BatchWriter writer(getBatchStdHandle(STD_OUTPUT_HANDLE));
+    LPCWSTR szInput = NULL;
+    LPCWSTR szOutput = NULL;
+    bool bArgsOK = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"compiledb")) continue;
+        if ((szInput == NULL) && (argv[i][0] != L'/')) {
+            szInput = argv[i];
+        } else if ((szOutput == NULL) && (argv[i][0] != L'/')) {
+            szOutput = argv[i];
+        } else bArgsOK = false;
+    }
+    if (!bArgsOK || (szOutput == NULL)) {
+        writer.write(L"Usage: TranslateErrorCode.exe /compiledb input.tsv output.tecdb\n"
+            L"Creates a code database from lines with Source<Tab>Code<Tab>Text\n");
+        return 1;
+    }
+
+    HANDLE hInput = CreateFile(szInput, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (hInput == INVALID_HANDLE_VALUE) {
+        writer.write(L"Input file could not be opened: ");
+        writer.write(szInput);
+        writer.write(L"\n");
+        return 1;
+    }
+
+    BatchReader* pReader = new BatchReader(hInput); // Buffer is too large for the stack
+    CodeDatabaseWriter database;
+    std::wstring sLine;
+    DWORD dwLine = 0;
+    DWORD dwCount = 0;
+    bool bInputOK = true;
+    wchar_t szInfo[100];
+
+    while (pReader->readLine(sLine)) {
+        dwLine++;
+        if (sLine.empty() || (sLine[0] == L'#')) continue; // Ignore empty lines and comments
+
+        size_t tab1 = sLine.find(L'\t');
+        size_t tab2 = (tab1 == std::wstring::npos) ? std::wstring::npos : sLine.find(L'\t', tab1 + 1);
+        ErrorSource source;
+        ParsedNumber number;
+        DWORD dwCode = 0;
+        if (tab2 != std::wstring::npos) {
+            sLine[tab1] = L'\0';
+            sLine[tab2] = L'\0';
+        }
+        if ((tab2 == std::wstring::npos) || (tab2 + 1 == sLine.size()) ||
+            !getSourceByName(sLine.c_str(), &source) || (source == SOURCE_WIN32) || (source == SOURCE_NTSTATUS) ||
+            (parseNumber(sLine.c_str() + tab1 + 1, tab2 - tab1 - 1, &number) != PARSE_OK) || !getErrorCode(number, &dwCode)) { // The number must fill the whole field
+            _snwprintf_s(szInfo, _countof(szInfo), _TRUNCATE, L"Invalid line %u\n", dwLine);
+            writer.write(szInfo);
+            bInputOK = false;
+            continue;
+        }
+        std::wstring sText = sLine.substr(tab2 + 1);
+        unescapeTsv(sText);
+        database.add(source, dwCode, sText.c_str(), sText.size());
+        dwCount++;
+    }
+    delete pReader;
+    CloseHandle(hInput);
+    if (!bInputOK) return 1;
+
+    if (!database.write(szOutput, 0)) {
+        writer.write(L"Database could not be written: ");
+        writer.write(szOutput);
+        writer.write(L"\n");
+        return 1;
+    }
+    _snwprintf_s(szInfo, _countof(szInfo), _TRUNCATE, L"%u codes written to ", dwCount);
+    writer.write(szInfo);
+    writer.write(szOutput);
+    writer.write(L"\n");
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runBatchMode
+
+  Summary:  Translate all error codes from the input file or stdin
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments, input file could not be opened or
+                  output could not be written
+
+-----------------------------------------------------------------F-F*/
+int runBatchMode(int argc, LPWSTR* argv) {
+    LPCWSTR szExport;
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"buildsnapshot")) return runBuildSnapshot(argc, argv);
+        if (isOption(argv[i], L"compiledb")) return runCompileDatabase(argc, argv);
+        if (isOption(argv[i], L"scan")) return runLogScan(argc, argv);
+        if (isOption(argv[i], L"list")) return runCodeListing(argc, argv);
+        if (isOption(argv[i], L"export", &szExport)) return runCodeExport(argc, argv);
+    }
+
+    HANDLE hOutput = getBatchStdHandle(STD_OUTPUT_HANDLE);
+    HANDLE hInput = NULL;
+    bool bInputFile = false;
+    LPCWSTR szFile = NULL;
+    LPCWSTR szValue;
+    BatchFormat format = FORMAT_TSV;
+    size_t threads = 1;
+    LANGID langIds[MAXLANGUAGES];
+    size_t languageCount = 0;
+    DWORD dwSources = SOURCEMASK_ALL;
+    bool bStats = false;
+    bool bArgsOK = true;
+
+    // Parse command line
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"batch")) continue;
+        if (isOption(argv[i], L"stats")) {
+            bStats = true;
+            continue;
+        }
+        if (isOption(argv[i], L"lang", &szValue)) {
+            languageCount = parseLanguageList(szValue, langIds);
+            if (languageCount == 0) bArgsOK = false;
+            continue;
+        }
+        if (isOption(argv[i], L"sources", &szValue)) {
+            dwSources = parseSourceList(szValue);
+            if (dwSources == 0) bArgsOK = false;
+            continue;
+        }
+        if (isOption(argv[i], L"format", &szValue)) {
+            if (_wcsicmp(szValue, L"tsv") == 0) format = FORMAT_TSV;
+            else if (_wcsicmp(szValue, L"json") == 0) format = FORMAT_JSON;
+            else bArgsOK = false;
+        } else if (isOption(argv[i], L"threads", &szValue)) {
+            int iThreads = 0;
+            if ((szValue[0] == L'\0') || (_wcsicmp(szValue, L"auto") == 0)) threads = getDefaultThreadCount();
+            else if (StrToIntEx(szValue, STIF_DEFAULT, &iThreads) && (iThreads >= 1) && (iThreads <= MAXWORKERTHREADS)) threads = iThreads;
+            else bArgsOK = false;
+        } else if ((szFile == NULL) && (argv[i][0] != L'/')) {
+            szFile = argv[i];
+        } else bArgsOK = false;
+    }
+
+    if (!bArgsOK) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Usage: TranslateErrorCode.exe /batch [file] [/format:tsv|json] [/threads:N|auto] [/lang:de-DE,en-US,...] [/sources:wu,ntstatus,...] [/stats]\n"
+            L"Translates the error codes (one per line) from file or stdin\n");
+        return 1;
+    }
+    g_bCollectStats = bStats; // Before the first lookup
+
+    if ((szFile == NULL) || (wcscmp(szFile, L"-") == 0)) {
+        hInput = getBatchStdHandle(STD_INPUT_HANDLE);
+    } else {
+        hInput = CreateFile(szFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (hInput == INVALID_HANDLE_VALUE) {
+            BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+            error.write(L"Input file could not be opened: ");
+            error.write(szFile);
+            error.write(L"\n");
+            return 1;
+        }
+        bInputFile = true;
+    }
+
+    BatchWriter writer(hOutput);
+    BatchReader* pReader = new BatchReader(hInput); // Buffers are too large for the stack
+    ResultListSink results;
+    std::wstring sLine;
+
+    if (format == FORMAT_TSV) {
+        wchar_t szTag[LANGUAGETAGSIZE];
+        writer.write(L"Input\tHex");
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            if ((dwSources & SOURCEBIT(source)) == 0) continue;
+            bool bLanguages = (source == SOURCE_WIN32) || (source == SOURCE_NTSTATUS);
+            size_t columns = (bLanguages && (languageCount > 0)) ? languageCount : 1;
+            for (size_t j = 0; j < columns; j++) {
+                writer.write(L"\t");
+                writer.write(getSourceName((ErrorSource)source));
+                if (bLanguages && (languageCount > 0) && (getLanguageTag(langIds[j], szTag) > 0)) {
+                    writer.write(L" (");
+                    writer.write(szTag);
+                    writer.write(L")");
+                }
+            }
+        }
+        writer.write(L"\n");
+    }
+
+    LookupStats stats = {};
+    ULONGLONG startTicks = getTicks();
+    if ((threads <= 1) || !runParallelBatch(*pReader, writer, format, threads, langIds, languageCount, dwSources, stats)) {
+        TranslateEngine* pEngine = new TranslateEngine();
+        pEngine->setLanguages(langIds, languageCount);
+        pEngine->setSources(dwSources);
+        while (pReader->readLine(sLine)) translateBatchLine(*pEngine, results, writer, format, sLine);
+        stats.add(pEngine->stats());
+        delete pEngine;
+    }
+    writer.flush();
+    if (bStats) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        writeBatchStats(error, stats, getTicks() - startTicks);
+    }
+
+    delete pReader;
+    if (bInputFile) CloseHandle(hInput);
+    if (writer.failed()) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Output could not be written\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "framework.h"
+#include <string>
+
+// Buffer size for reading input and writing output
+#define BATCHBUFFERSIZE 65536
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    BatchReader
+
+  Summary:  Buffered line reader for UTF-8/ANSI or UTF-16 (with BOM) input
+-----------------------------------------------------------------C-C*/
+class BatchReader {
+public:
+    explicit BatchReader(HANDLE hInput) : m_hInput(hInput) {}
+    bool readLine(std::wstring& sLine);
+private:
+    bool readByte(BYTE& byte);
+    HANDLE m_hInput;
+    BYTE m_buffer[BATCHBUFFERSIZE];
+    DWORD m_dwPos = 0;
+    DWORD m_dwLength = 0;
+    bool m_bEOF = false;
+    bool m_bStart = true;
+    bool m_bUTF16 = false;
+    std::string m_sLineBytes;
+};
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    BatchWriter
+
+  Summary:  Buffered writer for UTF-16 text. Writes UTF-16 to a console
+            and UTF-8 to files and pipes. Without output handle the text
+            is only collected in memory.
+-----------------------------------------------------------------C-C*/
+class BatchWriter {
+public:
+    explicit BatchWriter(HANDLE hOutput);
+    ~BatchWriter() { flush(); }
+    void write(const wchar_t* szText) { write(szText, wcslen(szText)); }
+    void write(const wchar_t* pText, size_t length);
+    void write(const std::wstring& sText) { write(sText.data(), sText.size()); }
+    void writeTsvEscaped(const wchar_t* szText);
+    void writeJsonEscaped(const wchar_t* szText);
+    void writeCsvEscaped(const wchar_t* szText);
+    void flush();
+    bool failed() const { return m_bFailed; }
+    std::wstring& buffer() { return m_sBuffer; }
+private:
+    HANDLE m_hOutput;
+    bool m_bConsole;
+    bool m_bFailed = false; // Output could not be written completely (e.g. disk full or pipe closed)
+    std::wstring m_sBuffer;
+    std::string m_sUTF8;
+};
+
+HANDLE getBatchStdHandle(DWORD nStdHandle);
+bool isOption(LPCWSTR szArg, LPCWSTR szName, LPCWSTR* pszValue = NULL);
+bool isBatchModeCommandLine(int argc, LPWSTR* argv);
+int runBatchMode(int argc, LPWSTR* argv);
@@ -0,0 +1,119 @@
+﻿/*+===================================================================
+  File:      ClipboardWatcher.cpp
+
+  Summary:   Clipboard watcher for the dialog. Each clipboard change is
+             checked with a cheap pre-filter (text format, short text, one
+             number without other chars), so the watcher can run all day.
+             Only a matching error code is translated.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "ClipboardWatcher.h"
+#include "CodeParser.h"
+#include <wctype.h>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ClipboardWatcher::start
+
+  Summary:  Register window for clipboard changes. The current content of
+            the clipboard is not checked.
+
+  Args:     HWND hWnd
+              Window receiving WM_CLIPBOARDUPDATE
+
+  Returns:  bool
+              true = success
+              false = error
+
+-----------------------------------------------------------------F-F*/
+bool ClipboardWatcher::start(HWND hWnd) {
+    if (m_hWnd != NULL) return true;
+    if (!AddClipboardFormatListener(hWnd)) return false;
+    m_hWnd = hWnd;
+    m_dwSequence = GetClipboardSequenceNumber();
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ClipboardWatcher::stop
+
+  Summary:  Unregister window
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void ClipboardWatcher::stop() {
+    if (m_hWnd == NULL) return;
+    RemoveClipboardFormatListener(m_hWnd);
+    m_hWnd = NULL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ClipboardWatcher::getErrorCode
+
+  Summary:  Check for an error code in the clipboard after WM_CLIPBOARDUPDATE.
+            The clipboard is only opened for text content and at most
+            MAXCLIPBOARDTEXTLENGTH chars are copied.
+
+  Args:     DWORD* pdwCode
+              Receives the error code
+            wchar_t* szText
+              Receives the error code as text (without surrounding spaces)
+            size_t cchText
+              Size of szText in chars
+
+  Returns:  bool
+              true = Clipboard contains a new error code
+              false = No error code or content already checked
+
+-----------------------------------------------------------------F-F*/
+bool ClipboardWatcher::getErrorCode(DWORD* pdwCode, wchar_t* szText, size_t cchText) {
+    if (m_hWnd == NULL) return false;
+
+    // Several notifications for one change (e.g. for delayed rendering)
+    DWORD dwSequence = GetClipboardSequenceNumber();
+    if (dwSequence == m_dwSequence) return false;
+    m_dwSequence = dwSequence;
+
+    if (!IsClipboardFormatAvailable(CF_UNICODETEXT)) return false; // Without opening the clipboard
+    if (!OpenClipboard(m_hWnd)) return false;
+    wchar_t szClipboard[MAXCLIPBOARDTEXTLENGTH + 1];
+    size_t length = 0;
+    bool bTerminated = false;
+    HGLOBAL hData = (HGLOBAL)GetClipboardData(CF_UNICODETEXT);
+    if (hData != NULL) {
+        const wchar_t* pData = (const wchar_t*)GlobalLock(hData);
+        if (pData != NULL) {
+            size_t cchData = GlobalSize(hData) / sizeof(wchar_t);
+            if (cchData > _countof(szClipboard)) cchData = _countof(szClipboard);
+            for (; length < cchData; length++) {
+                szClipboard[length] = pData[length];
+                if (szClipboard[length] == L'\0') {
+                    bTerminated = true;
+                    break;
+                }
+            }
+            GlobalUnlock(hData);
+        }
+    }
+    CloseClipboard();
+    if (!bTerminated) return false; // Too long
+
+    // Surrounding spaces and line breaks (e.g. a copied table cell)
+    size_t start = 0;
+    while ((start < length) && iswspace(szClipboard[start])) start++;
+    while ((length > start) && iswspace(szClipboard[length - 1])) length--;
+    if ((length == start) || (length - start >= cchText)) return false;
+
+    ParsedNumber number;
+    if (parseNumber(szClipboard + start, length - start, &number) != PARSE_OK) return false;
+    if (!::getErrorCode(number, pdwCode)) return false;
+    wcsncpy_s(szText, cchText, szClipboard + start, length - start);
+    return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "framework.h"
+
+// Max chars of a clipboard text checked for an error code, longer texts are ignored
+#define MAXCLIPBOARDTEXTLENGTH 40
+
+// Watches the clipboard for copied error codes. The owner window receives
+// WM_CLIPBOARDUPDATE and calls getErrorCode() to check the new content.
+class ClipboardWatcher {
+public:
+    ClipboardWatcher() {}
+    ~ClipboardWatcher() { stop(); }
+    ClipboardWatcher(const ClipboardWatcher&) = delete;
+    ClipboardWatcher& operator=(const ClipboardWatcher&) = delete;
+    bool start(HWND hWnd);
+    void stop();
+    bool isStarted() const { return m_hWnd != NULL; }
+    bool getErrorCode(DWORD* pdwCode, wchar_t* szText, size_t cchText);
+private:
+    HWND m_hWnd = NULL;
+    DWORD m_dwSequence = 0; // Sequence number of the last checked content
+};
@@ -0,0 +1,294 @@
+﻿/*+===================================================================
+  File:      CodeDatabase.cpp
+
+  Summary:   Binary file with sorted error codes and texts per source.
+             The file is memory mapped and the texts are used directly
+             from the mapping, so loading needs no parsing or allocations.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "CodeDatabase.h"
+#include <algorithm>
+#include <string>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabase::open
+
+  Summary:  Map database file into memory and check its structure
+
+  Args:     const wchar_t* szFile
+              Database file
+
+  Returns:  bool
+              true = Database is valid and ready for use
+              false = File does not exist or is invalid
+
+-----------------------------------------------------------------F-F*/
+bool CodeDatabase::open(const wchar_t* szFile) {
+    close();
+    m_hFile = CreateFile(szFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (m_hFile == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_hFile, &size) || (size.QuadPart < (LONGLONG)sizeof(CodeDatabaseHeader)) || (size.QuadPart > 0x7FFFFFFF)) {
+        close();
+        return false;
+    }
+    m_hMapping = CreateFileMapping(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m_hMapping != NULL) m_pView = (const BYTE*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+    if ((m_pView == NULL) || !validate((size_t)size.QuadPart)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabase::close
+
+  Summary:  Unmap database file
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void CodeDatabase::close() {
+    if (m_pView != NULL) UnmapViewOfFile(m_pView);
+    if (m_hMapping != NULL) CloseHandle(m_hMapping);
+    if (m_hFile != INVALID_HANDLE_VALUE) CloseHandle(m_hFile);
+    m_pView = NULL;
+    m_hMapping = NULL;
+    m_hFile = INVALID_HANDLE_VALUE;
+    m_pPool = NULL;
+    m_langId = 0;
+    for (SourceView& view : m_sources) view = SourceView();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabase::validate
+
+  Summary:  Check header, bounds, order of the codes and texts once, so
+            lookups need no further checks
+
+  Args:     size_t size
+              File size in bytes
+
+  Returns:  bool
+              true = Valid database
+
+-----------------------------------------------------------------F-F*/
+bool CodeDatabase::validate(size_t size) {
+    const CodeDatabaseHeader* pHeader = (const CodeDatabaseHeader*)m_pView;
+    if ((pHeader->magic != CODEDATABASEMAGIC) || (pHeader->version != CODEDATABASEVERSION)) return false;
+    if (pHeader->sourceCount > SOURCE_COUNT) return false;
+    if (sizeof(CodeDatabaseHeader) + (size_t)pHeader->sourceCount * sizeof(CodeDatabaseSource) > size) return false;
+    if ((pHeader->poolOffset % sizeof(wchar_t) != 0) || (pHeader->poolOffset > size) ||
+        ((size - pHeader->poolOffset) / sizeof(wchar_t) < pHeader->poolLength)) return false;
+    const wchar_t* pPool = (const wchar_t*)(m_pView + pHeader->poolOffset);
+
+    const CodeDatabaseSource* pSources = (const CodeDatabaseSource*)(pHeader + 1);
+    for (DWORD i = 0; i < pHeader->sourceCount; i++) {
+        const CodeDatabaseSource& source = pSources[i];
+        if ((source.source >= SOURCE_COUNT) || (m_sources[source.source].pCodes != NULL)) return false; // Unknown or duplicate source
+        if ((source.codesOffset % sizeof(DWORD) != 0) || (source.textsOffset % sizeof(DWORD) != 0)) return false;
+        if ((source.codesOffset > size) || ((size - source.codesOffset) / sizeof(DWORD) < source.count)) return false;
+        if ((source.textsOffset > size) || ((size - source.textsOffset) / sizeof(DWORD) < (size_t)source.count + 1)) return false;
+
+        const DWORD* pCodes = (const DWORD*)(m_pView + source.codesOffset);
+        const DWORD* pTextOffsets = (const DWORD*)(m_pView + source.textsOffset);
+        for (DWORD j = 0; j < source.count; j++) {
+            if ((j > 0) && (pCodes[j - 1] >= pCodes[j])) return false; // Not strictly ascending
+            if ((pTextOffsets[j] >= pTextOffsets[j + 1]) || (pTextOffsets[j + 1] > pHeader->poolLength)) return false;
+            if (pPool[pTextOffsets[j + 1] - 1] != L'\0') return false; // Not zero terminated
+        }
+        m_sources[source.source].pCodes = pCodes;
+        m_sources[source.source].pTextOffsets = pTextOffsets;
+        m_sources[source.source].count = source.count;
+    }
+    m_pPool = pPool;
+    m_langId = (LANGID)pHeader->langId;
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabase::find
+
+  Summary:  Binary search for an error code
+
+  Args:     ErrorSource source
+              Source
+            DWORD dwCode
+              Error code
+            const wchar_t** pszText
+              Receives the zero terminated text (points into the mapped file)
+            size_t* pLength
+              Receives the length of the text
+
+  Returns:  bool
+              true = Error code was found
+
+-----------------------------------------------------------------F-F*/
+bool CodeDatabase::find(ErrorSource source, DWORD dwCode, const wchar_t** pszText, size_t* pLength) const {
+    const SourceView& view = m_sources[source];
+    if (view.pCodes == NULL) return false;
+    const DWORD* pEnd = view.pCodes + view.count;
+    const DWORD* pCode = std::lower_bound(view.pCodes, pEnd, dwCode);
+    if ((pCode == pEnd) || (*pCode != dwCode)) return false;
+    size_t index = pCode - view.pCodes;
+    *pszText = m_pPool + view.pTextOffsets[index];
+    *pLength = view.pTextOffsets[index + 1] - view.pTextOffsets[index] - 1;
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabase::getEntry
+
+  Summary:  Get error code and text by index (for enumeration of all codes)
+
+  Args:     ErrorSource source
+              Source
+            size_t index
+              Index (0 ... getCount(source) - 1)
+            const wchar_t** pszText
+              Receives the zero terminated text (points into the mapped file)
+            size_t* pLength
+              Receives the length of the text
+
+  Returns:  DWORD
+              Error code
+
+-----------------------------------------------------------------F-F*/
+DWORD CodeDatabase::getEntry(ErrorSource source, size_t index, const wchar_t** pszText, size_t* pLength) const {
+    const SourceView& view = m_sources[source];
+    *pszText = m_pPool + view.pTextOffsets[index];
+    *pLength = view.pTextOffsets[index + 1] - view.pTextOffsets[index] - 1;
+    return view.pCodes[index];
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabaseWriter::add
+
+  Summary:  Add error code and text (first definition wins for duplicate codes)
+
+  Args:     ErrorSource source
+              Source
+            DWORD dwCode
+              Error code
+            const wchar_t* pText
+              Text
+            size_t length
+              Length of text in chars
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void CodeDatabaseWriter::add(ErrorSource source, DWORD dwCode, const wchar_t* pText, size_t length) {
+    m_entries[source].push_back({ dwCode, (DWORD)m_pool.size(), (DWORD)length });
+    m_pool.insert(m_pool.end(), pText, pText + length);
+    m_pool.push_back(L'\0');
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeDatabaseWriter::write
+
+  Summary:  Write database file. The file is written to a temporary file
+            first and renamed, so running programs with a mapping of the
+            old file are not affected.
+
+  Args:     const wchar_t* szFile
+              Database file
+            LANGID langId
+              Language of the texts, 0 = language independent
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool CodeDatabaseWriter::write(const wchar_t* szFile, LANGID langId) {
+    CodeDatabaseHeader header = {};
+    std::vector<CodeDatabaseSource> vSources;
+    std::vector<DWORD> vData; // Codes and text offsets of all sources
+    std::vector<wchar_t> vPool;
+
+    // Sort codes and remove duplicates
+    for (int source = 0; source < SOURCE_COUNT; source++) {
+        std::vector<Entry>& vEntries = m_entries[source];
+        if (vEntries.empty()) continue;
+        std::stable_sort(vEntries.begin(), vEntries.end(), [](const Entry& a, const Entry& b) { return a.code < b.code; });
+        vEntries.erase(std::unique(vEntries.begin(), vEntries.end(), [](const Entry& a, const Entry& b) { return a.code == b.code; }), vEntries.end());
+        vSources.push_back({ (DWORD)source, (DWORD)vEntries.size(), 0, 0 });
+    }
+
+    // Layout
+    size_t offset = sizeof(CodeDatabaseHeader) + vSources.size() * sizeof(CodeDatabaseSource);
+    for (CodeDatabaseSource& source : vSources) {
+        source.codesOffset = (DWORD)(offset + vData.size() * sizeof(DWORD));
+        for (const Entry& entry : m_entries[source.source]) vData.push_back(entry.code);
+        source.textsOffset = (DWORD)(offset + vData.size() * sizeof(DWORD));
+        for (const Entry& entry : m_entries[source.source]) {
+            vData.push_back((DWORD)vPool.size());
+            vPool.insert(vPool.end(), m_pool.begin() + entry.textOffset, m_pool.begin() + entry.textOffset + entry.length + 1);
+        }
+        vData.push_back((DWORD)vPool.size());
+    }
+    header.magic = CODEDATABASEMAGIC;
+    header.version = CODEDATABASEVERSION;
+    header.langId = langId;
+    header.sourceCount = (DWORD)vSources.size();
+    header.poolOffset = (DWORD)(offset + vData.size() * sizeof(DWORD));
+    header.poolLength = (DWORD)vPool.size();
+
+    // Write to temporary file
+    std::wstring sTempFile = std::wstring(szFile).append(L".tmp");
+    HANDLE hFile = CreateFile(sTempFile.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE) return false;
+    DWORD dwWritten;
+    bool bOK = WriteFile(hFile, &header, sizeof(header), &dwWritten, NULL) &&
+        (vSources.empty() || WriteFile(hFile, vSources.data(), (DWORD)(vSources.size() * sizeof(CodeDatabaseSource)), &dwWritten, NULL)) &&
+        (vData.empty() || WriteFile(hFile, vData.data(), (DWORD)(vData.size() * sizeof(DWORD)), &dwWritten, NULL)) &&
+        (vPool.empty() || WriteFile(hFile, vPool.data(), (DWORD)(vPool.size() * sizeof(wchar_t)), &dwWritten, NULL));
+    CloseHandle(hFile);
+    if (bOK) bOK = (MoveFileEx(sTempFile.c_str(), szFile, MOVEFILE_REPLACE_EXISTING) != FALSE);
+    if (!bOK) DeleteFile(sTempFile.c_str());
+    return bOK;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getCodeDatabase
+
+  Summary:  Get database from the folder of the program (or of the DLL,
+            when the code is used by TranslateErrorCodeLib). The database
+            is opened on the first call and shared by all engines.
+
+  Args:
+
+  Returns:  const CodeDatabase*
+              Database or NULL, if no valid database exists
+
+-----------------------------------------------------------------F-F*/
+const CodeDatabase* getCodeDatabase() {
+    static CodeDatabase* s_pDatabase = []() -> CodeDatabase* {
+        wchar_t szFile[MAX_PATH];
+        HMODULE hModule = NULL; // Module containing this code
+        if (!GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+            (LPCWSTR)&getCodeDatabase, &hModule)) return NULL;
+        DWORD dwLength = GetModuleFileName(hModule, szFile, MAX_PATH);
+        if ((dwLength == 0) || (dwLength >= MAX_PATH)) return NULL;
+        wchar_t* pName = wcsrchr(szFile, L'\\');
+        pName = (pName == NULL) ? szFile : pName + 1;
+        if (wcscpy_s(pName, MAX_PATH - (pName - szFile), CODEDATABASEFILE) != 0) return NULL;
+
+        CodeDatabase* pDatabase = new CodeDatabase(); // Never released, mapping is used until the program ends
+        if (!pDatabase->open(szFile)) {
+            delete pDatabase;
+            return NULL;
+        }
+        return pDatabase;
+    }();
+    return s_pDatabase;
+}
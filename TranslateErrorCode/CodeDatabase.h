@@ -0,0 +1,90 @@
+#pragma once
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+#include <vector>
+
+/*
+  File format of a code database (all values little endian DWORDs)
+
+  CodeDatabaseHeader
+  CodeDatabaseSource[sourceCount]
+  For each source:
+    DWORD codes[count]            Strictly ascending error codes
+    DWORD textOffsets[count + 1]  Char offsets of the texts in the string pool.
+                                  Text i is pool[textOffsets[i]] up to the zero
+                                  termination at pool[textOffsets[i + 1] - 1]
+  wchar_t pool[poolLength]        Zero terminated UTF-16 texts
+*/
+
+// "TCDB"
+#define CODEDATABASEMAGIC 0x42444354
+#define CODEDATABASEVERSION 1
+
+// File name of the optional database with WU, LDAP, StopCode/BugCheck and
+// Wininet codes in the program folder. Replaces the built-in tables for all
+// sources contained in the file.
+#define CODEDATABASEFILE L"TranslateErrorCode.tecdb"
+
+struct CodeDatabaseHeader {
+    DWORD magic;
+    DWORD version;
+    DWORD langId;       // Language of the texts, 0 = language independent
+    DWORD sourceCount;  // Number of CodeDatabaseSource entries after the header
+    DWORD poolOffset;   // Byte offset of the string pool in the file
+    DWORD poolLength;   // Chars in the string pool
+};
+
+struct CodeDatabaseSource {
+    DWORD source;       // ErrorSource
+    DWORD count;        // Number of codes
+    DWORD codesOffset;  // Byte offset of the codes in the file
+    DWORD textsOffset;  // Byte offset of the text offsets in the file
+};
+
+// Read only view of a memory mapped code database file
+class CodeDatabase {
+public:
+    CodeDatabase() {}
+    ~CodeDatabase() { close(); }
+    CodeDatabase(const CodeDatabase&) = delete;
+    CodeDatabase& operator=(const CodeDatabase&) = delete;
+    bool open(const wchar_t* szFile);
+    void close();
+    bool isOpen() const { return m_pView != NULL; }
+    LANGID langId() const { return m_langId; }
+    bool hasSource(ErrorSource source) const { return m_sources[source].pCodes != NULL; }
+    bool find(ErrorSource source, DWORD dwCode, const wchar_t** pszText, size_t* pLength) const;
+    size_t getCount(ErrorSource source) const { return m_sources[source].count; }
+    DWORD getEntry(ErrorSource source, size_t index, const wchar_t** pszText, size_t* pLength) const;
+private:
+    struct SourceView {
+        const DWORD* pCodes = NULL;
+        const DWORD* pTextOffsets = NULL;
+        DWORD count = 0;
+    };
+    bool validate(size_t size);
+    HANDLE m_hFile = INVALID_HANDLE_VALUE;
+    HANDLE m_hMapping = NULL;
+    const BYTE* m_pView = NULL;
+    const wchar_t* m_pPool = NULL;
+    LANGID m_langId = 0;
+    SourceView m_sources[SOURCE_COUNT];
+};
+
+// Creates a code database file
+class CodeDatabaseWriter {
+public:
+    void add(ErrorSource source, DWORD dwCode, const wchar_t* pText, size_t length);
+    bool write(const wchar_t* szFile, LANGID langId);
+private:
+    struct Entry {
+        DWORD code;
+        DWORD textOffset;
+        DWORD length;
+    };
+    std::vector<Entry> m_entries[SOURCE_COUNT];
+    std::vector<wchar_t> m_pool;
+};
+
+const CodeDatabase* getCodeDatabase();
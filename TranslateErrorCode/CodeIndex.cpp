@@ -0,0 +1,186 @@
+﻿/*+===================================================================
+  File:      CodeIndex.cpp
+
+  Summary:   Merged index of the error codes loaded from files. Each code
+             has one entry with a bit mask of the sources defining it and
+             its texts, so a code missing in all these sources is answered
+             with one hash probe and a known code gives the texts of all
+             of them without further lookups.
+
+             The index contains the Win32/HRESULT and NTSTATUS messages from
+             the message snapshot and the sources of the code database.
+             Sources with a built-in table and without code database are
+             not copied into the index, they keep their compile time
+             perfect hash. Without a snapshot the Win32/HRESULT and NTSTATUS
+             messages still come from FormatMessage. The index is built on
+             the first translation.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "CodeIndex.h"
+#include "CodeDatabase.h"
+#include "MessageSnapshot.h"
+#include <algorithm>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeIndex::CodeIndex
+
+  Summary:  Constructor, builds the index
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+CodeIndex::CodeIndex() : m_sourceMask(0), m_slotShift(32) {
+    const CodeDatabase* pSnapshot = getMessageSnapshot();
+    const CodeDatabase* pDatabase = getCodeDatabase();
+    std::vector<Item> items;
+    const wchar_t* szText;
+    size_t length;
+
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+        ErrorSource source = (ErrorSource)i;
+        const ErrorCodeTable* pTable = getSourceTable(source);
+        const CodeDatabase* pSource = (pTable == NULL) ? pSnapshot : pDatabase;
+        if ((pSource != NULL) && pSource->hasSource(source)) {
+            for (size_t j = 0; j < pSource->getCount(source); j++) {
+                DWORD dwCode = pSource->getEntry(source, j, &szText, &length);
+                items.push_back({ dwCode, source, std::wstring_view(szText, length) });
+            }
+            m_sourceMask |= SOURCEBIT(source);
+        } // Otherwise the built-in table or FormatMessage is used
+    }
+    build(items);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeIndex::build
+
+  Summary:  Create entries, texts and hash table from the list
+
+  Args:     std::vector<Item>& items
+              List (is sorted)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void CodeIndex::build(std::vector<Item>& items) {
+    // Sort by code and source, for duplicates the first text wins
+    std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+        return (a.code != b.code) ? (a.code < b.code) : (a.source < b.source);
+    });
+    m_texts.reserve(items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        const Item& item = items[i];
+        if ((i > 0) && (item.code == items[i - 1].code) && (item.source == items[i - 1].source)) continue;
+        if (m_entries.empty() || (m_entries.back().code != item.code)) m_entries.push_back({ item.code, 0, (DWORD)m_texts.size() });
+        m_entries.back().sourceMask |= SOURCEBIT(item.source);
+        m_texts.push_back(item.text);
+    }
+
+    // Hash table with a load factor of at most 50%
+    DWORD slotBits = 1;
+    while (((size_t)1 << slotBits) < m_entries.size() * 2) slotBits++;
+    m_slotShift = 32 - slotBits;
+    m_slots.assign((size_t)1 << slotBits, 0);
+    DWORD slotMask = (1u << slotBits) - 1;
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        DWORD slot = getHash(m_entries[i].code) >> m_slotShift;
+        while (m_slots[slot] != 0) slot = (slot + 1) & slotMask; // Linear probing
+        m_slots[slot] = (DWORD)i + 1;
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeIndex::find
+
+  Summary:  Get entry for a code
+
+  Args:     DWORD dwCode
+              Error code
+
+  Returns:  const CodeIndexEntry*
+              Entry or NULL, if no source contains the code
+
+-----------------------------------------------------------------F-F*/
+const CodeIndexEntry* CodeIndex::find(DWORD dwCode) const {
+    DWORD slotMask = (DWORD)m_slots.size() - 1;
+    DWORD slot = getHash(dwCode) >> m_slotShift;
+    DWORD index;
+    while ((index = m_slots[slot]) != 0) {
+        if (m_entries[index - 1].code == dwCode) return &m_entries[index - 1];
+        slot = (slot + 1) & slotMask;
+    }
+    return NULL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeIndex::lowerBound
+
+  Summary:  Get first entry with a code >= dwCode (binary search in the
+            sorted entries, for the enumeration of code ranges)
+
+  Args:     DWORD dwCode
+              Error code
+
+  Returns:  const CodeIndexEntry*
+              Entry or end(), if all codes are lower
+
+-----------------------------------------------------------------F-F*/
+const CodeIndexEntry* CodeIndex::lowerBound(DWORD dwCode) const {
+    return std::lower_bound(begin(), end(), dwCode, [](const CodeIndexEntry& entry, DWORD dwValue) {
+        return entry.code < dwValue;
+    });
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeIndex::getText
+
+  Summary:  Get text of an entry for one source
+
+  Args:     const CodeIndexEntry& entry
+              Entry
+            ErrorSource source
+              Source
+            const wchar_t** pszText
+              Receives the zero terminated text
+            size_t* pLength
+              Receives the length of the text
+
+  Returns:  bool
+              true = The source defines the code
+
+-----------------------------------------------------------------F-F*/
+bool CodeIndex::getText(const CodeIndexEntry& entry, ErrorSource source, const wchar_t** pszText, size_t* pLength) const {
+    if ((entry.sourceMask & SOURCEBIT(source)) == 0) return false;
+    // Texts of the lower sources are stored before
+    DWORD lowerMask = entry.sourceMask & (SOURCEBIT(source) - 1);
+    size_t index = entry.firstText;
+    while (lowerMask != 0) {
+        lowerMask &= lowerMask - 1;
+        index++;
+    }
+    *pszText = m_texts[index].data();
+    *pLength = m_texts[index].size();
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getCodeIndex
+
+  Summary:  Get code index. The index is built on the first call.
+
+  Args:
+
+  Returns:  const CodeIndex&
+
+-----------------------------------------------------------------F-F*/
+const CodeIndex& getCodeIndex() {
+    static const CodeIndex* s_pIndex = new CodeIndex(); // Never released, used until the program ends
+    return *s_pIndex;
+}
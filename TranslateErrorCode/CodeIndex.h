@@ -0,0 +1,50 @@
+#pragma once
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+#include <string_view>
+#include <vector>
+
+// Bit of a source in a source mask
+#define SOURCEBIT(source) (1u << (source))
+
+// Source mask with all sources
+#define SOURCEMASK_ALL (SOURCEBIT(SOURCE_COUNT) - 1)
+
+// Code with the sources defining it. The texts of the sources are stored
+// in ascending source order at firstText.
+struct CodeIndexEntry {
+    DWORD code;
+    DWORD sourceMask;
+    DWORD firstText;
+};
+
+// Merged index of all codes from the message snapshot and the code database.
+// A code is found with one hash probe (in most cases), which answers for all
+// these sources at once. Built-in tables are not part of the index.
+class CodeIndex {
+public:
+    CodeIndex();
+    const CodeIndexEntry* find(DWORD dwCode) const;
+    const CodeIndexEntry* lowerBound(DWORD dwCode) const;
+    const CodeIndexEntry* begin() const { return m_entries.data(); }
+    const CodeIndexEntry* end() const { return m_entries.data() + m_entries.size(); }
+    bool getText(const CodeIndexEntry& entry, ErrorSource source, const wchar_t** pszText, size_t* pLength) const;
+    DWORD sources() const { return m_sourceMask; }
+    size_t size() const { return m_entries.size(); }
+private:
+    struct Item {
+        DWORD code;
+        ErrorSource source;
+        std::wstring_view text; // Zero terminated, valid until the program ends
+    };
+    void build(std::vector<Item>& items);
+    static DWORD getHash(DWORD dwCode) { return dwCode * 2654435761u; }
+    DWORD m_sourceMask;                 // Sources completely contained in the index
+    std::vector<CodeIndexEntry> m_entries; // Sorted by code
+    std::vector<std::wstring_view> m_texts; // Views into the tables, the snapshot and the code database
+    std::vector<DWORD> m_slots;         // Open addressing hash, entry index + 1 (0 = empty)
+    DWORD m_slotShift;
+};
+
+const CodeIndex& getCodeIndex();
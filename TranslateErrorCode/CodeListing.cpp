@@ -0,0 +1,465 @@
+﻿/*+===================================================================
+  File:      CodeListing.cpp
+
+  Summary:   Listing of all known error codes in code ranges. The sorted
+             entries of the code index (code database and message snapshot)
+             and of the built-in tables are merged while walking, so each
+             range costs one binary search per source plus its codes,
+             independent of the size of the range. The codes are written in
+             ascending order while walking. Without a message snapshot the
+             Win32/HRESULT and NTSTATUS messages are enumerated from the
+             message tables and formatted while walking, as /buildsnapshot
+             does.
+
+             The export writes one record per code and source of all sources
+             as CSV or NDJSON (for lookup tables of other tools). The
+             records are escaped directly into the output buffer, which is
+             written in blocks of BATCHBUFFERSIZE chars, so the memory use
+             does not depend on the number of codes.
+
+             Usage:
+             TranslateErrorCode.exe /list [/range:first-last] [/facility:N] [/format:tsv|json]
+             TranslateErrorCode.exe /export:csv|ndjson
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "CodeListing.h"
+#include "BatchMode.h"
+#include "CodeIndex.h"
+#include "CodeParser.h"
+#include "MessageSnapshot.h"
+#include "TranslateEngine.h"
+#include <algorithm>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getFacilityRanges
+
+  Summary:  Get code ranges of a HRESULT facility (bits 26-16). Each
+            combination of the bits 31-27 gives one range of 0x10000
+            codes, the ranges are sorted ascending.
+
+  Args:     WORD facility
+              Facility (0-0x7FF)
+            CodeRange* pRanges
+              Receives MAXLISTRANGES ranges
+
+  Returns:  size_t
+              Number of ranges
+
+-----------------------------------------------------------------F-F*/
+size_t getFacilityRanges(WORD facility, CodeRange* pRanges) {
+    for (DWORD high = 0; high < MAXLISTRANGES; high++) {
+        pRanges[high].first = (high << 27) | ((DWORD)(facility & 0x7FF) << 16);
+        pRanges[high].last = pRanges[high].first | 0xFFFF;
+    }
+    return MAXLISTRANGES;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseCodeRange
+
+  Summary:  Parse range "first-last" or a single code
+
+  Args:     LPCWSTR szValue
+              Text
+            CodeRange* pRange
+              Receives the range
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+static bool parseCodeRange(LPCWSTR szValue, CodeRange* pRange) {
+    size_t length = wcslen(szValue);
+    ParsedNumber number;
+    if (parseNumberPrefix(szValue, length, &number) != PARSE_OK) return false;
+    if (!getErrorCode(number, &pRange->first)) return false;
+    pRange->last = pRange->first;
+    if (number.length == length) return true; // Single code
+
+    size_t pos = number.length;
+    if (szValue[pos] != L'-') return false;
+    pos++;
+    if (parseNumber(szValue + pos, length - pos, &number) != PARSE_OK) return false;
+    if (!getErrorCode(number, &pRange->last)) return false;
+    return pRange->first <= pRange->last;
+}
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    CodeWalker
+
+  Summary:  Walks in ascending order through the codes of a range in the
+            code index, in the built-in tables of the sources not
+            contained in the index and in the message IDs of the sources
+            enumerated from the message tables. The tables and IDs are
+            strictly sorted (tables checked at compile time), so each
+            source needs one binary search.
+-----------------------------------------------------------------C-C*/
+class CodeWalker {
+public:
+    CodeWalker(const CodeIndex& index, const CodeRange& range, const std::vector<DWORD>* pvMessageIds);
+    bool next(DWORD* pdwCode, const wchar_t** pszTexts);
+private:
+    const CodeIndex& m_index;
+    const CodeIndexEntry* m_pEntry;
+    const ErrorCodeEntry* m_pTableEntries[SOURCE_COUNT]; // Next entry of each built-in table
+    const ErrorCodeEntry* m_pTableEnds[SOURCE_COUNT];    // Equal to m_pTableEntries, when the table is not walked
+    const DWORD* m_pMessageIds[SOURCE_COUNT];            // Next ID of each source enumerated from the message tables
+    const DWORD* m_pMessageEnds[SOURCE_COUNT];           // Equal to m_pMessageIds, when the source is not enumerated
+    std::vector<wchar_t> m_vMessages[SOURCE_COUNT];      // Formatted message of each enumerated source (MESSAGEBUFFERSIZE chars)
+    DWORD m_last;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeWalker::CodeWalker
+
+  Summary:  Constructor, finds the first code of the range in each source
+
+  Args:     const CodeIndex& index
+              Code index
+            const CodeRange& range
+              Range
+            const std::vector<DWORD>* pvMessageIds
+              SOURCE_COUNT sorted ID lists from getMessageIds, empty =
+              The source is not enumerated from the message tables
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+CodeWalker::CodeWalker(const CodeIndex& index, const CodeRange& range, const std::vector<DWORD>* pvMessageIds) : m_index(index), m_last(range.last) {
+    m_pEntry = index.lowerBound(range.first);
+    for (int source = 0; source < SOURCE_COUNT; source++) {
+        const ErrorCodeTable* pTable = (index.sources() & SOURCEBIT(source)) ? NULL : getSourceTable((ErrorSource)source);
+        if (pTable == NULL) {
+            m_pTableEntries[source] = m_pTableEnds[source] = NULL;
+            continue;
+        }
+        m_pTableEnds[source] = pTable->pEntries + pTable->count;
+        m_pTableEntries[source] = std::lower_bound(pTable->pEntries, m_pTableEnds[source], range.first, [](const ErrorCodeEntry& entry, DWORD dwValue) {
+            return entry.code < dwValue;
+        });
+    }
+    for (int source = 0; source < SOURCE_COUNT; source++) {
+        const std::vector<DWORD>& vIds = pvMessageIds[source];
+        m_pMessageEnds[source] = vIds.data() + vIds.size();
+        m_pMessageIds[source] = std::lower_bound(vIds.data(), m_pMessageEnds[source], range.first);
+        if (!vIds.empty()) m_vMessages[source].resize(MESSAGEBUFFERSIZE);
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: CodeWalker::next
+
+  Summary:  Get the next code of the range with the texts of all sources
+
+  Args:     DWORD* pdwCode
+              Receives the code
+            const wchar_t** pszTexts
+              Receives SOURCE_COUNT zero terminated texts, NULL = The
+              source does not define the code
+
+  Returns:  bool
+              false = No more codes in the range
+
+-----------------------------------------------------------------F-F*/
+bool CodeWalker::next(DWORD* pdwCode, const wchar_t** pszTexts) {
+    bool bText = false;
+    DWORD dwCode = 0;
+    while (!bText) { // Message IDs without a message are skipped
+        // Lowest code of all sources
+        bool bFound = false;
+        if ((m_pEntry != m_index.end()) && (m_pEntry->code <= m_last)) {
+            dwCode = m_pEntry->code;
+            bFound = true;
+        }
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            const ErrorCodeEntry* pTableEntry = m_pTableEntries[source];
+            if ((pTableEntry != m_pTableEnds[source]) && (pTableEntry->code <= m_last) && (!bFound || (pTableEntry->code < dwCode))) {
+                dwCode = pTableEntry->code;
+                bFound = true;
+            }
+            const DWORD* pMessageId = m_pMessageIds[source];
+            if ((pMessageId != m_pMessageEnds[source]) && (*pMessageId <= m_last) && (!bFound || (*pMessageId < dwCode))) {
+                dwCode = *pMessageId;
+                bFound = true;
+            }
+        }
+        if (!bFound) return false;
+
+        // Texts of the sources defining the code
+        for (int source = 0; source < SOURCE_COUNT; source++) pszTexts[source] = NULL;
+        if ((m_pEntry != m_index.end()) && (m_pEntry->code == dwCode)) {
+            size_t length;
+            for (int source = 0; source < SOURCE_COUNT; source++) m_index.getText(*m_pEntry, (ErrorSource)source, &pszTexts[source], &length);
+            m_pEntry++;
+        }
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            if ((m_pTableEntries[source] != m_pTableEnds[source]) && (m_pTableEntries[source]->code == dwCode)) {
+                pszTexts[source] = m_pTableEntries[source]->text.data(); // View of a string literal, zero terminated
+                m_pTableEntries[source]++;
+            }
+            if ((m_pMessageIds[source] != m_pMessageEnds[source]) && (*m_pMessageIds[source] == dwCode)) {
+                // Texts of the code database stay in front of the system messages
+                if ((pszTexts[source] == NULL) && (formatSystemMessage((ErrorSource)source, dwCode, m_vMessages[source].data()) > 0)) pszTexts[source] = m_vMessages[source].data();
+                m_pMessageIds[source]++;
+            }
+            if (pszTexts[source] != NULL) bText = true;
+        }
+    }
+    *pdwCode = dwCode;
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getUnindexedMessageIds
+
+  Summary:  Enumerate the Win32/HRESULT and NTSTATUS message IDs from the
+            message tables, when no message snapshot is in the code index
+
+  Args:     std::vector<DWORD>* pvMessageIds
+              Receives SOURCE_COUNT sorted ID lists, empty for the sources
+              with texts in the code index and the built-in tables
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+static void getUnindexedMessageIds(std::vector<DWORD>* pvMessageIds) {
+    if (getMessageSnapshot() != NULL) return;
+    getMessageIds(SOURCE_WIN32, pvMessageIds[SOURCE_WIN32]);
+    getMessageIds(SOURCE_NTSTATUS, pvMessageIds[SOURCE_NTSTATUS]);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: writeListEntry
+
+  Summary:  Write one line with the texts of all sources of a code
+
+  Args:     BatchWriter& writer
+              Output
+            bool bJson
+              true = JSON, false = TSV
+            DWORD dwCode
+              Error code
+            const wchar_t* const* pszTexts
+              SOURCE_COUNT texts, NULL = The source does not define the code
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+static void writeListEntry(BatchWriter& writer, bool bJson, DWORD dwCode, const wchar_t* const* pszTexts) {
+    wchar_t szNumber[80];
+    if (bJson) {
+        _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"{\"code\":\"0x%08X\",\"dword\":%u,\"int\":%d,\"texts\":[", dwCode, dwCode, (int)dwCode);
+        writer.write(szNumber);
+        bool bFirst = true;
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            if (pszTexts[source] == NULL) continue;
+            writer.write(bFirst ? L"{\"source\":\"" : L",{\"source\":\"");
+            writer.writeJsonEscaped(getSourceName((ErrorSource)source));
+            writer.write(L"\",\"text\":\"");
+            writer.writeJsonEscaped(pszTexts[source]);
+            writer.write(L"\"}");
+            bFirst = false;
+        }
+        writer.write(L"]}\n");
+    } else {
+        _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"0x%08X", dwCode);
+        writer.write(szNumber);
+        // One column per source
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            writer.write(L"\t");
+            if (pszTexts[source] != NULL) writer.writeTsvEscaped(pszTexts[source]);
+        }
+        writer.write(L"\n");
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: writeExportRecord
+
+  Summary:  Write one record for a code and source
+
+  Args:     BatchWriter& writer
+              Output
+            bool bJson
+              true = NDJSON, false = CSV
+            DWORD dwCode
+              Error code
+            ErrorSource source
+              Source
+            const wchar_t* szText
+              Text of the source
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+static void writeExportRecord(BatchWriter& writer, bool bJson, DWORD dwCode, ErrorSource source, const wchar_t* szText) {
+    wchar_t szNumber[80];
+    if (bJson) {
+        _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"{\"code\":\"0x%08X\",\"dword\":%u,\"int\":%d,\"source\":\"", dwCode, dwCode, (int)dwCode);
+        writer.write(szNumber);
+        writer.writeJsonEscaped(getSourceName(source));
+        writer.write(L"\",\"text\":\"");
+        writer.writeJsonEscaped(szText);
+        writer.write(L"\"}\n");
+    } else {
+        _snwprintf_s(szNumber, _countof(szNumber), _TRUNCATE, L"0x%08X,%u,%d,", dwCode, dwCode, (int)dwCode);
+        writer.write(szNumber);
+        writer.writeCsvEscaped(getSourceName(source));
+        writer.write(L",");
+        writer.writeCsvEscaped(szText);
+        writer.write(L"\r\n");
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runCodeListing
+
+  Summary:  List all known codes in a range or facility (/list)
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments or output could not be written
+
+-----------------------------------------------------------------F-F*/
+int runCodeListing(int argc, LPWSTR* argv) {
+    CodeRange range = { 0, 0xFFFFFFFF };
+    CodeRange ranges[MAXLISTRANGES];
+    size_t rangeCount = 0;
+    bool bFacility = false;
+    bool bJson = false;
+    bool bArgsOK = true;
+    LPCWSTR szValue;
+
+    // Parse command line
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"list")) continue;
+        if (isOption(argv[i], L"range", &szValue)) {
+            if (!parseCodeRange(szValue, &range)) bArgsOK = false;
+        } else if (isOption(argv[i], L"facility", &szValue)) {
+            ParsedNumber number;
+            if ((parseNumber(szValue, wcslen(szValue), &number) == PARSE_OK) && !number.bNegative && (number.magnitude <= 0x7FF)) {
+                rangeCount = getFacilityRanges((WORD)number.magnitude, ranges);
+                bFacility = true;
+            } else bArgsOK = false;
+        } else if (isOption(argv[i], L"format", &szValue)) {
+            if (_wcsicmp(szValue, L"tsv") == 0) bJson = false;
+            else if (_wcsicmp(szValue, L"json") == 0) bJson = true;
+            else bArgsOK = false;
+        } else bArgsOK = false;
+    }
+    if (!bArgsOK) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Usage: TranslateErrorCode.exe /list [/range:first-last] [/facility:N] [/format:tsv|json]\n"
+            L"Lists all known error codes in the range and facility\n");
+        return 1;
+    }
+
+    // Ranges of the facility within the range
+    if (!bFacility) ranges[rangeCount++] = range;
+    else {
+        size_t count = 0;
+        for (size_t i = 0; i < rangeCount; i++) {
+            if ((ranges[i].last < range.first) || (ranges[i].first > range.last)) continue;
+            if (ranges[i].first < range.first) ranges[i].first = range.first;
+            if (ranges[i].last > range.last) ranges[i].last = range.last;
+            ranges[count++] = ranges[i];
+        }
+        rangeCount = count;
+    }
+
+    const CodeIndex& index = getCodeIndex();
+    std::vector<DWORD> vMessageIds[SOURCE_COUNT];
+    getUnindexedMessageIds(vMessageIds);
+
+    BatchWriter writer(getBatchStdHandle(STD_OUTPUT_HANDLE));
+    if (!bJson) {
+        writer.write(L"Hex");
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            writer.write(L"\t");
+            writer.write(getSourceName((ErrorSource)source));
+        }
+        writer.write(L"\n");
+    }
+
+    // Empty parts of a range are skipped by the binary searches
+    DWORD dwCode;
+    const wchar_t* szTexts[SOURCE_COUNT];
+    for (size_t i = 0; i < rangeCount; i++) {
+        CodeWalker walker(index, ranges[i], vMessageIds);
+        while (walker.next(&dwCode, szTexts)) writeListEntry(writer, bJson, dwCode, szTexts);
+    }
+    writer.flush();
+    if (writer.failed()) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Output could not be written\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runCodeExport
+
+  Summary:  Export all known codes of all sources (/export:csv|ndjson)
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments or output could not be written
+
+-----------------------------------------------------------------F-F*/
+int runCodeExport(int argc, LPWSTR* argv) {
+    bool bJson = false;
+    bool bArgsOK = true;
+    LPCWSTR szValue;
+
+    // Parse command line
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"export", &szValue)) {
+            if ((*szValue == L'\0') || (_wcsicmp(szValue, L"csv") == 0)) bJson = false;
+            else if (_wcsicmp(szValue, L"ndjson") == 0) bJson = true;
+            else bArgsOK = false;
+        } else bArgsOK = false;
+    }
+    if (!bArgsOK) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Usage: TranslateErrorCode.exe /export:csv|ndjson\n"
+            L"Exports all known error codes of all sources\n");
+        return 1;
+    }
+
+    const CodeIndex& index = getCodeIndex();
+    std::vector<DWORD> vMessageIds[SOURCE_COUNT];
+    getUnindexedMessageIds(vMessageIds);
+
+    // One record per code and source, in ascending order of the codes
+    BatchWriter writer(getBatchStdHandle(STD_OUTPUT_HANDLE));
+    if (!bJson) writer.write(L"Hex,DWORD,int,Source,Text\r\n");
+    DWORD dwCode;
+    const wchar_t* szTexts[SOURCE_COUNT];
+    CodeWalker walker(index, { 0, 0xFFFFFFFF }, vMessageIds);
+    while (walker.next(&dwCode, szTexts)) {
+        for (int source = 0; source < SOURCE_COUNT; source++) {
+            if (szTexts[source] != NULL) writeExportRecord(writer, bJson, dwCode, (ErrorSource)source, szTexts[source]);
+        }
+    }
+    writer.flush();
+    if (writer.failed()) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Output could not be written\n");
+        return 1;
+    }
+    return 0;
+}
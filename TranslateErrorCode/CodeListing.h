@@ -0,0 +1,16 @@
+#pragma once
+
+#include "framework.h"
+
+// Max number of code ranges for one listing (a facility needs 32 ranges)
+#define MAXLISTRANGES 32
+
+// Inclusive range of error codes
+struct CodeRange {
+    DWORD first;
+    DWORD last;
+};
+
+size_t getFacilityRanges(WORD facility, CodeRange* pRanges);
+int runCodeListing(int argc, LPWSTR* argv);
+int runCodeExport(int argc, LPWSTR* argv);
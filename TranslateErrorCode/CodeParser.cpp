@@ -0,0 +1,281 @@
+﻿/*+===================================================================
+  File:      CodeParser.cpp
+
+  Summary:   Parser for error codes as decimal or hexadecimal (0x...)
+             numbers. Used by the batch mode and the log file scanner
+             instead of StrToIntEx, which is locale aware and limited to
+             32 bit values.
+
+             The digits are classified with SSE2 (or AVX2, when compiled
+             with /arch:AVX2) 16 chars at once, so the length of a digit
+             run is known before the value is calculated.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "CodeParser.h"
+#if defined(_M_IX86) || defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define PARSER_SSE2
+#endif
+
+// Number of chars classified at once
+#define CLASSIFYCHARS 16
+
+// Value of hex digits ('0'...'9', 'A'...'F', 'a'...'f'), 0xFF for other ASCII chars
+static const BYTE c_abDigitValue[128] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getDigitValue
+
+  Summary:  Get value of a hex digit
+
+  Args:     CharT ch
+              Char
+
+  Returns:  unsigned int
+              0...15 or 0xFF for no hex digit
+
+-----------------------------------------------------------------F-F*/
+template <typename CharT>
+inline unsigned int getDigitValue(CharT ch) {
+    return ((unsigned int)ch < 128) ? c_abDigitValue[(unsigned int)ch] : 0xFF;
+}
+
+#ifdef PARSER_SSE2
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: classifyDigits
+
+  Summary:  Get bit masks of the decimal and hex digits of 16 chars
+
+  Args:     const CharT* p
+              16 chars
+            unsigned int* pDecimal
+              Receives bit i = 1, if p[i] is a decimal digit
+            unsigned int* pHex
+              Receives bit i = 1, if p[i] is a hex digit
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+inline void classifyDigits(const char* p, unsigned int* pDecimal, unsigned int* pHex) {
+    __m128i chars = _mm_loadu_si128((const __m128i*)p);
+    // Signed compare, non ASCII bytes are negative and never digits
+    __m128i decimal = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    *pDecimal = (unsigned int)_mm_movemask_epi8(decimal);
+    *pHex = *pDecimal | (unsigned int)_mm_movemask_epi8(letter);
+}
+
+inline void classifyDigits(const wchar_t* p, unsigned int* pDecimal, unsigned int* pHex) {
+#ifdef __AVX2__
+    __m256i chars = _mm256_loadu_si256((const __m256i*)p);
+    __m256i decimal = _mm256_and_si256(_mm256_cmpgt_epi16(chars, _mm256_set1_epi16('0' - 1)), _mm256_cmpgt_epi16(_mm256_set1_epi16('9' + 1), chars));
+    __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi16(0x20));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi16(lower, _mm256_set1_epi16('a' - 1)), _mm256_cmpgt_epi16(_mm256_set1_epi16('f' + 1), lower));
+    // Two mask bits per char, keep one
+    *pDecimal = _pext_u32((unsigned int)_mm256_movemask_epi8(decimal), 0x55555555);
+    *pHex = *pDecimal | _pext_u32((unsigned int)_mm256_movemask_epi8(letter), 0x55555555);
+#else
+    __m128i low = _mm_loadu_si128((const __m128i*)p);
+    __m128i high = _mm_loadu_si128((const __m128i*)(p + 8));
+    const __m128i zero = _mm_set1_epi16('0' - 1);
+    const __m128i nine = _mm_set1_epi16('9' + 1);
+    const __m128i a = _mm_set1_epi16('a' - 1);
+    const __m128i f = _mm_set1_epi16('f' + 1);
+    const __m128i lowerCase = _mm_set1_epi16(0x20);
+    // Signed compare, chars >= 0x8000 are negative and never digits
+    __m128i decimalLow = _mm_and_si128(_mm_cmpgt_epi16(low, zero), _mm_cmplt_epi16(low, nine));
+    __m128i decimalHigh = _mm_and_si128(_mm_cmpgt_epi16(high, zero), _mm_cmplt_epi16(high, nine));
+    low = _mm_or_si128(low, lowerCase);
+    high = _mm_or_si128(high, lowerCase);
+    __m128i letterLow = _mm_and_si128(_mm_cmpgt_epi16(low, a), _mm_cmplt_epi16(low, f));
+    __m128i letterHigh = _mm_and_si128(_mm_cmpgt_epi16(high, a), _mm_cmplt_epi16(high, f));
+    *pDecimal = (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(decimalLow, decimalHigh));
+    *pHex = *pDecimal | (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(letterLow, letterHigh));
+#endif
+}
+#endif
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getDigitRun
+
+  Summary:  Get number of consecutive decimal or hex digits
+
+  Args:     const CharT* p
+              First char
+            size_t length
+              Chars available
+            bool bHex
+              true = Hex digits, false = decimal digits
+
+  Returns:  size_t
+              Number of digits
+
+-----------------------------------------------------------------F-F*/
+template <typename CharT>
+size_t getDigitRun(const CharT* p, size_t length, bool bHex) {
+    size_t run = 0;
+#ifdef PARSER_SSE2
+    CharT padded[CLASSIFYCHARS];
+    unsigned int decimal, hex;
+    while (run < length) {
+        const CharT* pBlock = p + run;
+        size_t available = length - run;
+        if (available < CLASSIFYCHARS) { // Never read behind the text
+            for (size_t i = 0; i < CLASSIFYCHARS; i++) padded[i] = (i < available) ? pBlock[i] : 0;
+            pBlock = padded;
+        }
+        classifyDigits(pBlock, &decimal, &hex);
+        unsigned long nonDigit;
+        if (_BitScanForward(&nonDigit, ~(bHex ? hex : decimal) & 0xFFFF)) return run + ((nonDigit < available) ? nonDigit : available);
+        run += CLASSIFYCHARS;
+    }
+    return length;
+#else
+    while ((run < length) && (getDigitValue(p[run]) < (bHex ? 16u : 10u))) run++;
+    return run;
+#endif
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseNumberPrefix
+
+  Summary:  Parse number at the begin of a text
+
+  Args:     const CharT* pText
+              Text
+            size_t length
+              Length of text
+            ParsedNumber* pNumber
+              Receives the number
+
+  Returns:  ParseResult
+              PARSE_OK, PARSE_INVALID (no digits) or PARSE_OVERFLOW
+
+-----------------------------------------------------------------F-F*/
+template <typename CharT>
+ParseResult parseNumberPrefix(const CharT* pText, size_t length, ParsedNumber* pNumber) {
+    size_t pos = 0;
+    pNumber->bNegative = false;
+    pNumber->bHex = false;
+    pNumber->magnitude = 0;
+    pNumber->length = 0;
+    if ((length > 0) && ((pText[0] == (CharT)'-') || ((sizeof(CharT) > 1) && ((unsigned int)pText[0] == 0x2212)))) {
+        pNumber->bNegative = true;
+        pos++;
+    }
+    if ((pos + 1 < length) && (pText[pos] == (CharT)'0') && ((pText[pos + 1] | 0x20) == (CharT)'x')) {
+        pNumber->bHex = true;
+        pos += 2;
+    }
+
+    size_t digits = getDigitRun(pText + pos, length - pos, pNumber->bHex);
+    if (digits == 0) return PARSE_INVALID;
+    const CharT* p = pText + pos;
+    size_t i = 0;
+    ULONGLONG value = 0;
+    if (pNumber->bHex) {
+        while ((i < digits) && (p[i] == (CharT)'0')) i++; // Leading zeros
+        if (digits - i > 16) return PARSE_OVERFLOW;
+        for (; i < digits; i++) value = (value << 4) | getDigitValue(p[i]);
+    } else {
+        for (; i < digits; i++) {
+            unsigned int digit = getDigitValue(p[i]);
+            if (value > (0xFFFFFFFFFFFFFFFFull - digit) / 10) return PARSE_OVERFLOW;
+            value = value * 10 + digit;
+        }
+    }
+    if (pNumber->bNegative && (value > 0x8000000000000000ull)) return PARSE_OVERFLOW;
+    pNumber->magnitude = value;
+    pNumber->length = pos + digits;
+    return PARSE_OK;
+}
+
+template ParseResult parseNumberPrefix<char>(const char* pText, size_t length, ParsedNumber* pNumber);
+template ParseResult parseNumberPrefix<wchar_t>(const wchar_t* pText, size_t length, ParsedNumber* pNumber);
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseNumber
+
+  Summary:  Parse text, which must contain only a number
+
+  Args:     const wchar_t* pText
+              Text
+            size_t length
+              Length of text
+            ParsedNumber* pNumber
+              Receives the number
+
+  Returns:  ParseResult
+              PARSE_OK, PARSE_INVALID or PARSE_OVERFLOW
+
+-----------------------------------------------------------------F-F*/
+ParseResult parseNumber(const wchar_t* pText, size_t length, ParsedNumber* pNumber) {
+    ParseResult result = parseNumberPrefix(pText, length, pNumber);
+    if ((result == PARSE_OK) && (pNumber->length != length)) return PARSE_INVALID; // Unexpected chars after the number
+    return result;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getErrorCode
+
+  Summary:  Get 32 bit error code for a number. Positive numbers up to
+            0xFFFFFFFF are used as DWORD, negative numbers down to
+            -2147483648 as int. Sign extended 64 bit values (like
+            0xFFFFFFFFC0000005) give their lower 32 bits.
+
+  Args:     const ParsedNumber& number
+              Number
+            DWORD* pdwCode
+              Receives the error code
+
+  Returns:  bool
+              true = success
+              false = Number is out of the 32 bit range
+
+-----------------------------------------------------------------F-F*/
+bool getErrorCode(const ParsedNumber& number, DWORD* pdwCode) {
+    ULONGLONG qwCode;
+    if (!getErrorCode64(number, &qwCode)) return false;
+    return narrowErrorCode(qwCode, pdwCode);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getErrorCode64
+
+  Summary:  Get 64 bit value for a number. Negative numbers down to
+            -9223372036854775808 are stored as two's complement, so a
+            negative 32 bit error code gives its sign extended value.
+
+  Args:     const ParsedNumber& number
+              Number
+            ULONGLONG* pqwCode
+              Receives the value
+
+  Returns:  bool
+              true = success
+              false = Number is out of the 64 bit range
+
+-----------------------------------------------------------------F-F*/
+bool getErrorCode64(const ParsedNumber& number, ULONGLONG* pqwCode) {
+    if (number.bNegative) {
+        if (number.magnitude > 0x8000000000000000ull) return false;
+        *pqwCode = 0 - number.magnitude;
+    } else *pqwCode = number.magnitude;
+    return true;
+}
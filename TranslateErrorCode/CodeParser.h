@@ -0,0 +1,49 @@
+#pragma once
+
+#include "framework.h"
+
+// Result of parsing a number
+enum ParseResult {
+    PARSE_OK,
+    PARSE_INVALID,  // No number or unexpected chars
+    PARSE_OVERFLOW  // Number does not fit into 64 bits
+};
+
+// Parsed number as sign and magnitude
+struct ParsedNumber {
+    ULONGLONG magnitude;
+    bool bNegative;
+    bool bHex;
+    size_t length;  // Parsed chars incl. sign and 0x
+};
+
+// Parse number at the begin of a text: optional sign ('-' or Unicode minus
+// U+2212 for wchar_t) followed by 0x and hex digits or by decimal digits.
+// The text does not need a termination.
+template <typename CharT>
+ParseResult parseNumberPrefix(const CharT* pText, size_t length, ParsedNumber* pNumber);
+
+ParseResult parseNumber(const wchar_t* pText, size_t length, ParsedNumber* pNumber);
+bool getErrorCode(const ParsedNumber& number, DWORD* pdwCode);
+bool getErrorCode64(const ParsedNumber& number, ULONGLONG* pqwCode);
+
+// Narrow a code of the key width KeyT to the 32 bit key of the tables and
+// the code index. The 32 bit version compiles to a copy, 64 bit values
+// are accepted, when they are zero or sign extended 32 bit values (like
+// NTSTATUS values printed by 64 bit tools as 0xFFFFFFFFC0000005).
+template <typename KeyT>
+bool narrowErrorCode(KeyT code, DWORD* pdwCode);
+
+template <>
+inline bool narrowErrorCode<DWORD>(DWORD code, DWORD* pdwCode) {
+    *pdwCode = code;
+    return true;
+}
+
+template <>
+inline bool narrowErrorCode<ULONGLONG>(ULONGLONG code, DWORD* pdwCode) {
+    DWORD dwHigh = (DWORD)(code >> 32);
+    if ((dwHigh != 0) && ((dwHigh != 0xFFFFFFFF) || ((code & 0x80000000) == 0))) return false;
+    *pdwCode = (DWORD)code;
+    return true;
+}
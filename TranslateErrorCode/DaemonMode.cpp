@@ -0,0 +1,251 @@
+﻿/*+===================================================================
+  File:      DaemonMode.cpp
+
+  Summary:   Resident mode with a tray icon. While the program runs, the
+             named pipe server answers translation requests from other
+             programs and the dialog can be opened from the tray icon
+             without loading the tables again.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "DaemonMode.h"
+#include "TranslateErrorCode.h"
+#include "TranslateEngine.h"
+#include "BatchMode.h"
+#include "PipeServer.h"
+#include "WorkStealingPool.h"
+#include <shellapi.h>
+
+// Global variables
+HINSTANCE g_hDaemonInst = NULL;
+UINT g_uTaskbarCreated = 0;
+bool g_bDaemonDialogOpen = false;
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isDaemonModeCommandLine
+
+  Summary:  Check, if the program was started in resident mode
+
+  Args:     int argc
+              Number of arguments
+            LPWSTR* argv
+              Arguments
+
+  Returns:  bool
+              true = Resident mode
+
+-----------------------------------------------------------------F-F*/
+bool isDaemonModeCommandLine(int argc, LPWSTR* argv) {
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"daemon")) return true;
+    }
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getDaemonSources
+
+  Summary:  Get the sources for the pipe server from the command line
+            (/sources:wu,ntstatus,...)
+
+  Args:     int argc
+              Number of arguments
+            LPWSTR* argv
+              Arguments
+
+  Returns:  DWORD
+              Mask of the sources (SOURCEBIT), 0 = invalid list
+
+-----------------------------------------------------------------F-F*/
+DWORD getDaemonSources(int argc, LPWSTR* argv) {
+    DWORD dwSources = SOURCEMASK_ALL;
+    LPCWSTR szValue;
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"sources", &szValue)) dwSources = parseSourceList(szValue);
+    }
+    return dwSources;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: addTrayIcon
+
+  Summary:  Add icon to the notification area
+
+  Args:     HWND hWnd
+              Window for the icon messages
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool addTrayIcon(HWND hWnd) {
+    NOTIFYICONDATA nid = {};
+    nid.cbSize = sizeof(nid);
+    nid.hWnd = hWnd;
+    nid.uID = TRAYICONID;
+    nid.uFlags = NIF_ICON | NIF_MESSAGE | NIF_TIP;
+    nid.uCallbackMessage = WM_APP_TRAYICON;
+    nid.hIcon = (HICON)LoadImage(g_hDaemonInst, MAKEINTRESOURCE(IDI_TRANSLATEERRORCODE), IMAGE_ICON,
+        GetSystemMetrics(SM_CXSMICON), GetSystemMetrics(SM_CYSMICON), LR_SHARED);
+    wcsncpy_s(nid.szTip, LoadStringAsWstr(g_hDaemonInst, IDS_TRAYTOOLTIP).c_str(), _TRUNCATE);
+    return (Shell_NotifyIcon(NIM_ADD, &nid) != FALSE);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: removeTrayIcon
+
+  Summary:  Remove icon from the notification area
+
+  Args:     HWND hWnd
+              Window for the icon messages
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void removeTrayIcon(HWND hWnd) {
+    NOTIFYICONDATA nid = {};
+    nid.cbSize = sizeof(nid);
+    nid.hWnd = hWnd;
+    nid.uID = TRAYICONID;
+    Shell_NotifyIcon(NIM_DELETE, &nid);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: openDaemonDialog
+
+  Summary:  Show the main dialog (modal, only once at a time)
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void openDaemonDialog() {
+    if (g_bDaemonDialogOpen) return;
+    g_bDaemonDialogOpen = true;
+    DialogBox(g_hDaemonInst, MAKEINTRESOURCE(IDD_MAIN), NULL, WndProcMainDialog);
+    g_bDaemonDialogOpen = false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: showTrayMenu
+
+  Summary:  Show context menu of the tray icon at the cursor position
+
+  Args:     HWND hWnd
+              Window for the menu commands
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void showTrayMenu(HWND hWnd) {
+    HMENU hMenu = CreatePopupMenu();
+    if (hMenu == NULL) return;
+    AppendMenu(hMenu, MF_STRING | (g_bDaemonDialogOpen ? MF_GRAYED : 0), IDM_TRAYOPEN, LoadStringAsWstr(g_hDaemonInst, IDS_TRAYOPEN).c_str());
+    AppendMenu(hMenu, MF_SEPARATOR, 0, NULL);
+    AppendMenu(hMenu, MF_STRING, IDM_TRAYEXIT, LoadStringAsWstr(g_hDaemonInst, IDS_TRAYEXIT).c_str());
+    SetMenuDefaultItem(hMenu, IDM_TRAYOPEN, FALSE);
+    POINT pt;
+    GetCursorPos(&pt);
+    SetForegroundWindow(hWnd); // Otherwise the menu does not close on a click outside
+    TrackPopupMenu(hMenu, TPM_RIGHTBUTTON, pt.x, pt.y, 0, hWnd, NULL);
+    PostMessage(hWnd, WM_NULL, 0, 0);
+    DestroyMenu(hMenu);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WndProcDaemon
+
+  Summary:  Process window messages of the hidden tray icon window
+
+  Args:     HWND hWnd
+            UINT message
+            WPARAM wParam
+            LPARAM lParam
+
+  Returns:  LRESULT
+
+-----------------------------------------------------------------F-F*/
+LRESULT CALLBACK WndProcDaemon(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) {
+    if ((g_uTaskbarCreated != 0) && (message == g_uTaskbarCreated)) { // Explorer was restarted
+        addTrayIcon(hWnd);
+        return 0;
+    }
+    switch (message) {
+        case WM_APP_TRAYICON:
+            switch (lParam) {
+                case WM_LBUTTONDBLCLK:
+                    openDaemonDialog();
+                    break;
+                case WM_RBUTTONUP:
+                    showTrayMenu(hWnd);
+                    break;
+            }
+            return 0;
+        case WM_COMMAND:
+            switch (LOWORD(wParam)) {
+                case IDM_TRAYOPEN:
+                    openDaemonDialog();
+                    return 0;
+                case IDM_TRAYEXIT:
+                    DestroyWindow(hWnd); // An open dialog ends with the WM_QUIT message
+                    return 0;
+            }
+            break;
+        case WM_DESTROY:
+            removeTrayIcon(hWnd);
+            PostQuitMessage(0);
+            return 0;
+    }
+    return DefWindowProc(hWnd, message, wParam, lParam);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runDaemonMode
+
+  Summary:  Start the named pipe server and show the tray icon until
+            "Exit" is selected in its menu
+
+  Args:     HINSTANCE hInstance
+              Handle to instance module
+            DWORD dwSources
+              Mask of the sources for the pipe server (SOURCEBIT)
+
+  Returns:  int
+              0 = success
+              1 = error, invalid sources or another instance is already running
+
+-----------------------------------------------------------------F-F*/
+int runDaemonMode(HINSTANCE hInstance, DWORD dwSources) {
+    g_hDaemonInst = hInstance;
+
+    PipeServer server;
+    if ((dwSources == 0) || !server.start(getDefaultThreadCount(), dwSources)) return 1;
+    startWarmUp(); // Load snapshot and code index before the first request
+
+    WNDCLASSEX wcex = {};
+    wcex.cbSize = sizeof(wcex);
+    wcex.lpfnWndProc = WndProcDaemon;
+    wcex.hInstance = hInstance;
+    wcex.lpszClassName = DAEMONWINDOWCLASS;
+    if (RegisterClassEx(&wcex) == 0) return 1;
+
+    // Hidden top level window instead of a message-only window, because
+    // only top level windows get the "TaskbarCreated" broadcast
+    g_uTaskbarCreated = RegisterWindowMessage(L"TaskbarCreated");
+    HWND hWnd = CreateWindowEx(0, DAEMONWINDOWCLASS, L"TranslateErrorCode", WS_OVERLAPPED,
+        0, 0, 0, 0, NULL, NULL, hInstance, NULL);
+    if (hWnd == NULL) return 1;
+    addTrayIcon(hWnd); // Can fail, when the taskbar does not exist yet. The icon is added on "TaskbarCreated".
+
+    MSG msg;
+    while (GetMessage(&msg, NULL, 0, 0) > 0) {
+        TranslateMessage(&msg);
+        DispatchMessage(&msg);
+    }
+    return 0;
+}
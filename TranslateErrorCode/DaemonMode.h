@@ -0,0 +1,16 @@
+#pragma once
+
+#include "framework.h"
+
+// Message from the tray icon (lParam = Mouse message)
+#define WM_APP_TRAYICON (WM_APP + 2)
+
+// Window class of the hidden window for the tray icon
+#define DAEMONWINDOWCLASS L"TranslateErrorCodeDaemon"
+
+// ID of the tray icon
+#define TRAYICONID 1
+
+bool isDaemonModeCommandLine(int argc, LPWSTR* argv);
+DWORD getDaemonSources(int argc, LPWSTR* argv);
+int runDaemonMode(HINSTANCE hInstance, DWORD dwSources);
@@ -0,0 +1,92 @@
+﻿/*+===================================================================
+  File:      ErrorCodeDecoder.cpp
+
+  Summary:   Splits an error code into severity, customer bit, facility
+             and code of HRESULT and NTSTATUS and selects the sources
+             for the lookup from the facility, so codes are only searched
+             where they can exist:
+
+             - HRESULT_FROM_NT(x): NTSTATUS x (and stop codes like 0x1000007E)
+             - HRESULT_FROM_WIN32(x): Win32/HRESULT and Wininet x
+             - FACILITY_WINDOWSUPDATE: Win32/HRESULT and WU
+             - Customer codes: Stop codes only
+             - Codes up to 0xFFFF: All sources
+             - Other codes: Win32/HRESULT, NTSTATUS and stop codes
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "ErrorCodeDecoder.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: decodeErrorCode
+
+  Summary:  Split error code into the HRESULT/NTSTATUS fields
+
+  Args:     DWORD dwCode
+              Error code
+            DecodedErrorCode* pDecoded
+              Receives the fields
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void decodeErrorCode(DWORD dwCode, DecodedErrorCode* pDecoded) {
+    pDecoded->code = dwCode;
+    pDecoded->severity = (BYTE)(dwCode >> 30);
+    pDecoded->bFailure = (dwCode & 0x80000000) != 0;
+    pDecoded->bCustomer = (dwCode & CUSTOMERBIT) != 0;
+    pDecoded->bNtBit = (dwCode & FACILITY_NT_BIT) != 0;
+    pDecoded->facility = (WORD)((dwCode >> 16) & 0x7FF);
+    pDecoded->value = (WORD)(dwCode & 0xFFFF);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getSourceLookups
+
+  Summary:  Get the sources to search for a decoded error code. The
+            lookups are sorted by source, so the results keep the
+            usual order.
+
+  Args:     const DecodedErrorCode& decoded
+              Error code
+            SourceLookup* pLookups
+              Receives the lookups (SOURCE_COUNT entries)
+
+  Returns:  size_t
+              Number of lookups
+
+-----------------------------------------------------------------F-F*/
+size_t getSourceLookups(const DecodedErrorCode& decoded, SourceLookup* pLookups) {
+    size_t count = 0;
+    if (decoded.bNtBit && !decoded.bCustomer) { // HRESULT_FROM_NT
+        pLookups[count++] = { SOURCE_NTSTATUS, decoded.code & ~FACILITY_NT_BIT };
+        pLookups[count++] = { SOURCE_BUGCHECK, decoded.code };
+        return count;
+    }
+    if (decoded.bCustomer) { // Not defined by Microsoft, but stop codes can have any value
+        pLookups[count++] = { SOURCE_BUGCHECK, decoded.code };
+        return count;
+    }
+    if ((decoded.severity == 2) && (decoded.facility == FACILITY_WIN32)) { // HRESULT_FROM_WIN32
+        pLookups[count++] = { SOURCE_WIN32, decoded.code };
+        pLookups[count++] = { SOURCE_WININET, decoded.value };
+        return count;
+    }
+    if (((decoded.severity == 0) || (decoded.severity == 2)) && (decoded.facility == FACILITY_WINDOWSUPDATE)) {
+        pLookups[count++] = { SOURCE_WIN32, decoded.code };
+        pLookups[count++] = { SOURCE_WU, decoded.code };
+        return count;
+    }
+    pLookups[count++] = { SOURCE_WIN32, decoded.code };
+    pLookups[count++] = { SOURCE_NTSTATUS, decoded.code };
+    if (decoded.code <= 0xFFFF) { // Plain Win32, LDAP or Wininet code
+        pLookups[count++] = { SOURCE_LDAP, decoded.code };
+        pLookups[count++] = { SOURCE_BUGCHECK, decoded.code };
+        pLookups[count++] = { SOURCE_WININET, decoded.code };
+    } else pLookups[count++] = { SOURCE_BUGCHECK, decoded.code };
+    return count;
+}
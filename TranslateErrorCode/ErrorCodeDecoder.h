@@ -0,0 +1,27 @@
+#pragma once
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+
+// Customer bit of HRESULT and NTSTATUS
+#define CUSTOMERBIT 0x20000000
+
+// Error code split into the HRESULT/NTSTATUS fields
+struct DecodedErrorCode {
+    DWORD code;        // Error code
+    BYTE severity;     // NTSTATUS severity (bits 31-30): 0 = success, 1 = informational, 2 = warning, 3 = error
+    bool bFailure;     // HRESULT severity (bit 31)
+    bool bCustomer;    // Customer bit (bit 29)
+    bool bNtBit;       // HRESULT_FROM_NT (bit 28)
+    WORD facility;     // HRESULT facility (bits 26-16)
+    WORD value;        // Code within the facility (bits 15-0)
+};
+
+// Lookup of an error code in one source
+struct SourceLookup {
+    ErrorSource source;
+    DWORD code;        // Code to search in the source (e.g. the Win32 code of HRESULT_FROM_WIN32)
+};
+
+void decodeErrorCode(DWORD dwCode, DecodedErrorCode* pDecoded);
+size_t getSourceLookups(const DecodedErrorCode& decoded, SourceLookup* pLookups);
@@ -0,0 +1,1548 @@
+﻿/*+===================================================================
+  File:      ErrorCodeTables.cpp
+
+  Summary:   Static error code definitions for
+             - Windows Update
+             - LDAP
+             - BugCheck/StopCode
+             - Wininet
+
+             The tables are constexpr arrays sorted by code, so they are
+             placed into the read only data section and need no
+             initialization at program start. For each table a minimal
+             perfect hash is built at compile time, so a lookup is one
+             probe without comparisons along a search path. Order and
+             uniqueness of the codes are checked at compile time.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Table:    c_aBugCheckCodes
+
+  Summary:  Error code definitions for stop codes
+            Based on https://learn.microsoft.com/de-de/windows-hardware/drivers/debugger/bug-check-code-reference2
+-------------------------------------------------------------------*/
+constexpr ErrorCodeEntry c_aBugCheckCodes[] = {
+    { 0x00000001, L"APC_INDEX_MISMATCH" },
+    { 0x00000002, L"DEVICE_QUEUE_NOT_BUSY" },
+    { 0x00000003, L"INVALID_AFFINITY_SET" },
+    { 0x00000004, L"INVALID_DATA_ACCESS_TRAP" },
+    { 0x00000005, L"INVALID_PROCESS_ATTACH_ATTEMPT" },
+    { 0x00000006, L"INVALID_PROCESS_DETACH_ATTEMPT" },
+    { 0x00000007, L"INVALID_SOFTWARE_INTERRUPT" },
+    { 0x00000008, L"IRQL_NOT_DISPATCH_LEVEL" },
+    { 0x00000009, L"IRQL_NOT_GREATER_OR_EQUAL" },
+    { 0x0000000A, L"IRQL_NOT_LESS_OR_EQUAL" },
+    { 0x0000000B, L"NO_EXCEPTION_HANDLING_SUPPORT" },
+    { 0x0000000C, L"MAXIMUM_WAIT_OBJECTS_EXCEEDED" },
+    { 0x0000000D, L"MUTEX_LEVEL_NUMBER_VIOLATION" },
+    { 0x0000000E, L"NO_USER_MODE_CONTEXT" },
+    { 0x0000000F, L"SPIN_LOCK_ALREADY_OWNED" },
+    { 0x00000010, L"SPIN_LOCK_NOT_OWNED" },
+    { 0x00000011, L"THREAD_NOT_MUTEX_OWNER" },
+    { 0x00000012, L"TRAP_CAUSE_UNKNOWN" },
+    { 0x00000013, L"EMPTY_THREAD_REAPER_LIST" },
+    { 0x00000014, L"CREATE_DELETE_LOCK_NOT_LOCKED" },
+    { 0x00000015, L"LAST_CHANCE_CALLED_FROM_KMODE" },
+    { 0x00000016, L"CID_HANDLE_CREATION" },
+    { 0x00000017, L"CID_HANDLE_DELETION" },
+    { 0x00000018, L"REFERENCE_BY_POINTER" },
+    { 0x00000019, L"BAD_POOL_HEADER" },
+    { 0x0000001A, L"MEMORY_MANAGEMENT" },
+    { 0x0000001B, L"PFN_SHARE_COUNT" },
+    { 0x0000001C, L"PFN_REFERENCE_COUNT" },
+    { 0x0000001D, L"NO_SPIN_LOCK_AVAILABLE" },
+    { 0x0000001E, L"KMODE_EXCEPTION_NOT_HANDLED" },
+    { 0x0000001F, L"SHARED_RESOURCE_CONV_ERROR" },
+    { 0x00000020, L"KERNEL_APC_PENDING_DURING_EXIT" },
+    { 0x00000021, L"QUOTA_UNDERFLOW" },
+    { 0x00000022, L"FILE_SYSTEM" },
+    { 0x00000023, L"FAT_FILE_SYSTEM" },
+    { 0x00000024, L"NTFS_FILE_SYSTEM" },
+    { 0x00000025, L"NPFS_FILE_SYSTEM" },
+    { 0x00000026, L"CDFS_FILE_SYSTEM" },
+    { 0x00000027, L"RDR_FILE_SYSTEM" },
+    { 0x00000028, L"CORRUPT_ACCESS_TOKEN" },
+    { 0x00000029, L"SECURITY_SYSTEM" },
+    { 0x0000002A, L"INCONSISTENT_IRP" },
+    { 0x0000002B, L"PANIC_STACK_SWITCH" },
+    { 0x0000002C, L"PORT_DRIVER_INTERNAL" },
+    { 0x0000002D, L"SCSI_DISK_DRIVER_INTERNAL" },
+    { 0x0000002E, L"DATA_BUS_ERROR" },
+    { 0x0000002F, L"INSTRUCTION_BUS_ERROR" },
+    { 0x00000030, L"SET_OF_INVALID_CONTEXT" },
+    { 0x00000031, L"PHASE0_INITIALIZATION_FAILED" },
+    { 0x00000032, L"PHASE1_INITIALIZATION_FAILED" },
+    { 0x00000033, L"UNEXPECTED_INITIALIZATION_CALL" },
+    { 0x00000034, L"CACHE_MANAGER" },
+    { 0x00000035, L"NO_MORE_IRP_STACK_LOCATIONS" },
+    { 0x00000036, L"DEVICE_REFERENCE_COUNT_NOT_ZERO" },
+    { 0x00000037, L"FLOPPY_INTERNAL_ERROR" },
+    { 0x00000038, L"SERIAL_DRIVER_INTERNAL" },
+    { 0x00000039, L"SYSTEM_EXIT_OWNED_MUTEX" },
+    { 0x0000003A, L"SYSTEM_UNWIND_PREVIOUS_USER" },
+    { 0x0000003B, L"SYSTEM_SERVICE_EXCEPTION" },
+    { 0x0000003C, L"INTERRUPT_UNWIND_ATTEMPTED" },
+    { 0x0000003D, L"INTERRUPT_EXCEPTION_NOT_HANDLED" },
+    { 0x0000003E, L"MULTIPROCESSOR_CONFIGURATION_NOT_SUPPORTED" },
+    { 0x0000003F, L"NO_MORE_SYSTEM_PTES" },
+    { 0x00000040, L"TARGET_MDL_TOO_SMALL" },
+    { 0x00000041, L"MUST_SUCCEED_POOL_EMPTY" },
+    { 0x00000042, L"ATDISK_DRIVER_INTERNAL" },
+    { 0x00000043, L"NO_SUCH_PARTITION" },
+    { 0x00000044, L"MULTIPLE_IRP_COMPLETE_REQUESTS" },
+    { 0x00000045, L"INSUFFICIENT_SYSTEM_MAP_REGS" },
+    { 0x00000046, L"DEREF_UNKNOWN_LOGON_SESSION" },
+    { 0x00000047, L"REF_UNKNOWN_LOGON_SESSION" },
+    { 0x00000048, L"CANCEL_STATE_IN_COMPLETED_IRP" },
+    { 0x00000049, L"PAGE_FAULT_WITH_INTERRUPTS_OFF" },
+    { 0x0000004A, L"IRQL_GT_ZERO_AT_SYSTEM_SERVICE" },
+    { 0x0000004B, L"STREAMS_INTERNAL_ERROR" },
+    { 0x0000004C, L"FATAL_UNHANDLED_HARD_ERROR" },
+    { 0x0000004D, L"NO_PAGES_AVAILABLE" },
+    { 0x0000004E, L"PFN_LIST_CORRUPT" },
+    { 0x0000004F, L"NDIS_INTERNAL_ERROR" },
+    { 0x00000050, L"PAGE_FAULT_IN_NONPAGED_AREA" },
+    { 0x00000051, L"REGISTRY_ERROR" },
+    { 0x00000052, L"MAILSLOT_FILE_SYSTEM" },
+    { 0x00000053, L"NO_BOOT_DEVICE" },
+    { 0x00000054, L"LM_SERVER_INTERNAL_ERROR" },
+    { 0x00000055, L"DATA_COHERENCY_EXCEPTION" },
+    { 0x00000056, L"INSTRUCTION_COHERENCY_EXCEPTION" },
+    { 0x00000057, L"XNS_INTERNAL_ERROR" },
+    { 0x00000058, L"FTDISK_INTERNAL_ERROR" },
+    { 0x00000059, L"PINBALL_FILE_SYSTEM" },
+    { 0x0000005A, L"CRITICAL_SERVICE_FAILED" },
+    { 0x0000005B, L"SET_ENV_VAR_FAILED" },
+    { 0x0000005C, L"HAL_INITIALIZATION_FAILED" },
+    { 0x0000005D, L"UNSUPPORTED_PROCESSOR" },
+    { 0x0000005E, L"OBJECT_INITIALIZATION_FAILED" },
+    { 0x0000005F, L"SECURITY_INITIALIZATION_FAILED" },
+    { 0x00000060, L"PROCESS_INITIALIZATION_FAILED" },
+    { 0x00000061, L"HAL1_INITIALIZATION_FAILED" },
+    { 0x00000062, L"OBJECT1_INITIALIZATION_FAILED" },
+    { 0x00000063, L"SECURITY1_INITIALIZATION_FAILED" },
+    { 0x00000064, L"SYMBOLIC_INITIALIZATION_FAILED" },
+    { 0x00000065, L"MEMORY1_INITIALIZATION_FAILED" },
+    { 0x00000066, L"CACHE_INITIALIZATION_FAILED" },
+    { 0x00000067, L"CONFIG_INITIALIZATION_FAILED" },
+    { 0x00000068, L"FILE_INITIALIZATION_FAILED" },
+    { 0x00000069, L"IO1_INITIALIZATION_FAILED" },
+    { 0x0000006A, L"LPC_INITIALIZATION_FAILED" },
+    { 0x0000006B, L"PROCESS1_INITIALIZATION_FAILED" },
+    { 0x0000006C, L"REFMON_INITIALIZATION_FAILED" },
+    { 0x0000006D, L"SESSION1_INITIALIZATION_FAILED" },
+    { 0x0000006E, L"SESSION2_INITIALIZATION_FAILED" },
+    { 0x0000006F, L"SESSION3_INITIALIZATION_FAILED" },
+    { 0x00000070, L"SESSION4_INITIALIZATION_FAILED" },
+    { 0x00000071, L"SESSION5_INITIALIZATION_FAILED" },
+    { 0x00000072, L"ASSIGN_DRIVE_LETTERS_FAILED" },
+    { 0x00000073, L"CONFIG_LIST_FAILED" },
+    { 0x00000074, L"BAD_SYSTEM_CONFIG_INFO" },
+    { 0x00000075, L"CANNOT_WRITE_CONFIGURATION" },
+    { 0x00000076, L"PROCESS_HAS_LOCKED_PAGES" },
+    { 0x00000077, L"KERNEL_STACK_INPAGE_ERROR" },
+    { 0x00000078, L"PHASE0_EXCEPTION" },
+    { 0x00000079, L"MISMATCHED_HAL" },
+    { 0x0000007A, L"KERNEL_DATA_INPAGE_ERROR" },
+    { 0x0000007B, L"INACCESSIBLE_BOOT_DEVICE" },
+    { 0x0000007C, L"BUGCODE_NDIS_DRIVER" },
+    { 0x0000007D, L"INSTALL_MORE_MEMORY" },
+    { 0x0000007E, L"SYSTEM_THREAD_EXCEPTION_NOT_HANDLED" },
+    { 0x0000007F, L"UNEXPECTED_KERNEL_MODE_TRAP" },
+    { 0x00000080, L"NMI_HARDWARE_FAILURE" },
+    { 0x00000081, L"SPIN_LOCK_INIT_FAILURE" },
+    { 0x00000082, L"DFS_FILE_SYSTEM" },
+    { 0x00000085, L"SETUP_FAILURE" },
+    { 0x0000008B, L"MBR_CHECKSUM_MISMATCH" },
+    { 0x0000008E, L"KERNEL_MODE_EXCEPTION_NOT_HANDLED" },
+    { 0x0000008F, L"PP0_INITIALIZATION_FAILED" },
+    { 0x00000090, L"PP1_INITIALIZATION_FAILED" },
+    { 0x00000092, L"UP_DRIVER_ON_MP_SYSTEM" },
+    { 0x00000093, L"INVALID_KERNEL_HANDLE" },
+    { 0x00000094, L"KERNEL_STACK_LOCKED_AT_EXIT" },
+    { 0x00000096, L"INVALID_WORK_QUEUE_ITEM" },
+    { 0x00000097, L"BOUND_IMAGE_UNSUPPORTED" },
+    { 0x00000098, L"END_OF_NT_EVALUATION_PERIOD" },
+    { 0x00000099, L"INVALID_REGION_OR_SEGMENT" },
+    { 0x0000009A, L"SYSTEM_LICENSE_VIOLATION" },
+    { 0x0000009B, L"UDFS_FILE_SYSTEM" },
+    { 0x0000009C, L"MACHINE_CHECK_EXCEPTION" },
+    { 0x0000009E, L"USER_MODE_HEALTH_MONITOR" },
+    { 0x0000009F, L"DRIVER_POWER_STATE_FAILURE" },
+    { 0x000000A0, L"INTERNAL_POWER_ERROR" },
+    { 0x000000A1, L"PCI_BUS_DRIVER_INTERNAL" },
+    { 0x000000A2, L"MEMORY_IMAGE_CORRUPT" },
+    { 0x000000A3, L"ACPI_DRIVER_INTERNAL" },
+    { 0x000000A4, L"CNSS_FILE_SYSTEM_FILTER" },
+    { 0x000000A5, L"ACPI_BIOS_ERROR" },
+    { 0x000000A7, L"BAD_EXHANDLE" },
+    { 0x000000AC, L"HAL_MEMORY_ALLOCATION" },
+    { 0x000000AD, L"VIDEO_DRIVER_DEBUG_REPORT_REQUEST" },
+    { 0x000000B1, L"BGI_DETECTED_VIOLATION" },
+    { 0x000000B4, L"VIDEO_DRIVER_INIT_FAILURE" },
+    { 0x000000B8, L"ATTEMPTED_SWITCH_FROM_DPC" },
+    { 0x000000B9, L"CHIPSET_DETECTED_ERROR" },
+    { 0x000000BA, L"SESSION_HAS_VALID_VIEWS_ON_EXIT" },
+    { 0x000000BB, L"NETWORK_BOOT_INITIALIZATION_FAILED" },
+    { 0x000000BC, L"NETWORK_BOOT_DUPLICATE_ADDRESS" },
+    { 0x000000BD, L"INVALID_HIBERNATED_STATE" },
+    { 0x000000BE, L"ATTEMPTED_WRITE_TO_READONLY_MEMORY" },
+    { 0x000000BF, L"MUTEX_ALREADY_OWNED" },
+    { 0x000000C1, L"SPECIAL_POOL_DETECTED_MEMORY_CORRUPTION" },
+    { 0x000000C2, L"BAD_POOL_CALLER" },
+    { 0x000000C4, L"DRIVER_VERIFIER_DETECTED_VIOLATION" },
+    { 0x000000C5, L"DRIVER_CORRUPTED_EXPOOL" },
+    { 0x000000C6, L"DRIVER_CAUGHT_MODIFYING_FREED_POOL" },
+    { 0x000000C7, L"TIMER_OR_DPC_INVALID" },
+    { 0x000000C8, L"IRQL_UNEXPECTED_VALUE" },
+    { 0x000000C9, L"DRIVER_VERIFIER_IOMANAGER_VIOLATION" },
+    { 0x000000CA, L"PNP_DETECTED_FATAL_ERROR" },
+    { 0x000000CB, L"DRIVER_LEFT_LOCKED_PAGES_IN_PROCESS" },
+    { 0x000000CC, L"PAGE_FAULT_IN_FREED_SPECIAL_POOL" },
+    { 0x000000CD, L"PAGE_FAULT_BEYOND_END_OF_ALLOCATION" },
+    { 0x000000CE, L"DRIVER_UNLOADED_WITHOUT_CANCELLING_PENDING_OPERATIONS" },
+    { 0x000000CF, L"TERMINAL_SERVER_DRIVER_MADE_INCORRECT_MEMORY_REFERENCE" },
+    { 0x000000D0, L"DRIVER_CORRUPTED_MMPOOL" },
+    { 0x000000D1, L"DRIVER_IRQL_NOT_LESS_OR_EQUAL" },
+    { 0x000000D2, L"BUGCODE_ID_DRIVER" },
+    { 0x000000D3, L"DRIVER_PORTION_MUST_BE_NONPAGED" },
+    { 0x000000D4, L"SYSTEM_SCAN_AT_RAISED_IRQL_CAUGHT_IMPROPER_DRIVER_UNLOAD" },
+    { 0x000000D5, L"DRIVER_PAGE_FAULT_IN_FREED_SPECIAL_POOL" },
+    { 0x000000D6, L"DRIVER_PAGE_FAULT_BEYOND_END_OF_ALLOCATION" },
+    { 0x000000D7, L"DRIVER_UNMAPPING_INVALID_VIEW" },
+    { 0x000000D8, L"DRIVER_USED_EXCESSIVE_PTES" },
+    { 0x000000D9, L"LOCKED_PAGES_TRACKER_CORRUPTION" },
+    { 0x000000DA, L"SYSTEM_PTE_MISUSE" },
+    { 0x000000DB, L"DRIVER_CORRUPTED_SYSPTES" },
+    { 0x000000DC, L"DRIVER_INVALID_STACK_ACCESS" },
+    { 0x000000DE, L"POOL_CORRUPTION_IN_FILE_AREA" },
+    { 0x000000DF, L"IchMPERSONATING_WORKER_THREAD" },
+    { 0x000000E0, L"Schwerwiegender Fehler C1250" },
+    { 0x000000E1, L"WORKER_THREAD_RETURNED_AT_BAD_IRQL" },
+    { 0x000000E2, L"MANUALLY_INITIATED_CRASH" },
+    { 0x000000E3, L"RESOURCE_NOT_OWNED" },
+    { 0x000000E4, L"WORKER_INVALID" },
+    { 0x000000E6, L"DRIVER_VERIFIER_DMA_VIOLATION" },
+    { 0x000000E7, L"INVALID_FLOATING_POINT_STATE" },
+    { 0x000000E8, L"INVALID_CANCEL_OF_FILE_OPEN" },
+    { 0x000000E9, L"ACTIVE_EX_WORKER_THREAD_TERMINATION" },
+    { 0x000000EA, L"THREAD_STUCK_IN_DEVICE_DRIVER" },
+    { 0x000000EB, L"DIRTY_MAPPED_PAGES_CONGESTION" },
+    { 0x000000EC, L"SESSION_HAS_VALID_SPECIAL_POOL_ON_EXIT" },
+    { 0x000000ED, L"UNMOUNTABLE_BOOT_VOLUME" },
+    { 0x000000EF, L"CRITICAL_PROCESS_DIED" },
+    { 0x000000F0, L"STORAGE_MINIPORT_ERROR" },
+    { 0x000000F1, L"SCSI_VERIFIER_DETECTED_VIOLATION" },
+    { 0x000000F2, L"HARDWARE_INTERRUPT_STORM" },
+    { 0x000000F3, L"DISORDERLY_SHUTDOWN" },
+    { 0x000000F4, L"CRITICAL_OBJECT_TERMINATION" },
+    { 0x000000F5, L"FLTMGR_FILE_SYSTEM" },
+    { 0x000000F6, L"PCI_VERIFIER_DETECTED_VIOLATION" },
+    { 0x000000F7, L"DRIVER_OVERRAN_STACK_BUFFER" },
+    { 0x000000F8, L"RAMDISK_BOOT_INITIALIZATION_FAILED" },
+    { 0x000000F9, L"DRIVER_RETURNED_STATUS_REPARSE_FOR_VOLUME_OPEN" },
+    { 0x000000FA, L"HTTP_DRIVER_CORRUPTED" },
+    { 0x000000FC, L"ATTEMPTED_EXECUTE_OF_NOEXECUTE_MEMORY" },
+    { 0x000000FD, L"DIRTY_NOWRITE_PAGES_CONGESTION" },
+    { 0x000000FE, L"BUGCODE_USB_DRIVER" },
+    { 0x000000FF, L"RESERVE_QUEUE_OVERFLOW" },
+    { 0x00000100, L"LOADER_BLOCK_MISMATCH" },
+    { 0x00000101, L"CLOCK_WATCHDOG_TIMEOUT" },
+    { 0x00000102, L"DPC_WATCHDOG_TIMEOUT" },
+    { 0x00000103, L"MUP_FILE_SYSTEM" },
+    { 0x00000104, L"AGP_INVALID_ACCESS" },
+    { 0x00000105, L"AGP_GART_CORRUPTION" },
+    { 0x00000106, L"AGP_ILLEGALLY_REPROGRAMMED" },
+    { 0x00000108, L"THIRD_PARTY_FILE_SYSTEM_FAILURE" },
+    { 0x00000109, L"CRITICAL_STRUCTURE_CORRUPTION" },
+    { 0x0000010A, L"APP_TAGGING_INITIALIZATION_FAILED" },
+    { 0x0000010C, L"FSRTL_EXTRA_CREATE_PARAMETER_VIOLATION" },
+    { 0x0000010D, L"WDF_VIOLATION" },
+    { 0x0000010E, L"VIDEO_MEMORY_MANAGEMENT_INTERNAL" },
+    { 0x0000010F, L"RESOURCE_MANAGER_EXCEPTION_NOT_HANDLED" },
+    { 0x00000111, L"RECURSIVE_NMI" },
+    { 0x00000112, L"MSRPC_STATE_VIOLATION" },
+    { 0x00000113, L"VIDEO_DXGKRNL_FATAL_ERROR" },
+    { 0x00000114, L"VIDEO_SHADOW_DRIVER_FATAL_ERROR" },
+    { 0x00000115, L"AGP_INTERNAL" },
+    { 0x00000116, L"VIDEO_TDR_FAILURE" },
+    { 0x00000117, L"VIDEO_TDR_TIMEOUT_DETECTED" },
+    { 0x00000119, L"VIDEO_SCHEDULER_INTERNAL_ERROR" },
+    { 0x0000011A, L"EM_INITIALIZATION_FAILURE" },
+    { 0x0000011B, L"DRIVER_RETURNED_HOLDING_CANCEL_LOCK" },
+    { 0x0000011C, L"ATTEMPTED_WRITE_TO_CM_PROTECTED_STORAGE" },
+    { 0x0000011D, L"EVENT_TRACING_FATAL_ERROR" },
+    { 0x0000011E, L"TOO_MANY_RECURSIVE_FAULTS" },
+    { 0x0000011F, L"INVALID_DRIVER_HANDLE" },
+    { 0x00000120, L"BITLOCKER_FATAL_ERROR" },
+    { 0x00000121, L"DRIVER_VIOLATION" },
+    { 0x00000122, L"WHEA_INTERNAL_ERROR" },
+    { 0x00000123, L"CRYPTO_SELF_TEST_FAILURE" },
+    { 0x00000124, L"WHEA_UNCORRECTABLE_ERROR" },
+    { 0x00000125, L"NMR_INVALID_STATE" },
+    { 0x00000126, L"NETIO_INVALID_POOL_CALLER" },
+    { 0x00000127, L"PAGE_NOT_ZERO" },
+    { 0x00000128, L"WORKER_THREAD_RETURNED_WITH_BAD_IO_PRIORITY" },
+    { 0x00000129, L"WORKER_THREAD_RETURNED_WITH_BAD_PAGING_IO_PRIORITY" },
+    { 0x0000012A, L"MUI_NO_VALID_SYSTEM_LANGUAGE" },
+    { 0x0000012B, L"FAULTY_HARDWARE_CORRUPTED_PAGE" },
+    { 0x0000012C, L"EXFAT_FILE_SYSTEM" },
+    { 0x0000012D, L"VOLSNAP_OVERLAPPED_TABLE_ACCESS" },
+    { 0x0000012E, L"INVALID_MDL_RANGE" },
+    { 0x0000012F, L"VHD_BOOT_INITIALIZATION_FAILED" },
+    { 0x00000130, L"DYNAMIC_ADD_PROCESSOR_MISMATCH" },
+    { 0x00000131, L"INVALID_EXTENDED_PROCESSOR_STATE" },
+    { 0x00000132, L"RESOURCE_OWNER_POINTER_INVALID" },
+    { 0x00000133, L"DPC_WATCHDOG_VIOLATION" },
+    { 0x00000134, L"DRIVE_EXTENDER" },
+    { 0x00000135, L"REGISTRY_FILTER_DRIVER_EXCEPTION" },
+    { 0x00000136, L"VHD_BOOT_HOST_VOLUME_NOT_ENOUGH_SPACE" },
+    { 0x00000137, L"WIN32K_HANDLE_MANAGER" },
+    { 0x00000138, L"GPIO_CONTROLLER_DRIVER_ERROR" },
+    { 0x00000139, L"KERNEL_SECURITY_CHECK_FAILURE" },
+    { 0x0000013A, L"KERNEL_MODE_HEAP_CORRUPTION" },
+    { 0x0000013B, L"PASSIVE_INTERRUPT_ERROR" },
+    { 0x0000013C, L"INVALID_IO_BOOST_STATE" },
+    { 0x0000013D, L"CRITICAL_INITIALIZATION_FAILURE" },
+    { 0x00000140, L"STORAGE_DEVICE_ABNORMALITY_DETECTED" },
+    { 0x00000143, L"PROCESSOR_DRIVER_INTERNAL" },
+    { 0x00000144, L"BUGCODE_USB3_DRIVER" },
+    { 0x00000145, L"SECURE_BOOT_VIOLATION" },
+    { 0x00000147, L"ABNORMAL_RESET_DETECTED" },
+    { 0x00000149, L"REFS_FILE_SYSTEM" },
+    { 0x0000014A, L"KERNEL_WMI_INTERNAL" },
+    { 0x0000014B, L"SOC_SUBSYSTEM_FAILURE" },
+    { 0x0000014C, L"FATAL_ABNORMAL_RESET_ERROR" },
+    { 0x0000014D, L"EXCEPTION_SCOPE_INVALID" },
+    { 0x0000014E, L"SOC_CRITICAL_DEVICE_REMOVED" },
+    { 0x0000014F, L"PDC_WATCHDOG_TIMEOUT" },
+    { 0x00000150, L"TCPIP_AOAC_NIC_ACTIVE_REFERENCE_LEAK" },
+    { 0x00000151, L"UNSUPPORTED_INSTRUCTION_MODE" },
+    { 0x00000152, L"INVALID_PUSH_LOCK_FLAGS" },
+    { 0x00000153, L"KERNEL_LOCK_ENTRY_LEAKED_ON_THREAD_TERMINATION" },
+    { 0x00000154, L"UNEXPECTED_STORE_EXCEPTION" },
+    { 0x00000155, L"OS_DATA_TAMPERING" },
+    { 0x00000157, L"KERNEL_THREAD_PRIORITY_FLOOR_VIOLATION" },
+    { 0x00000158, L"ILLEGAL_IOMMU_PAGE_FAULT" },
+    { 0x00000159, L"HAL_ILLEGAL_IOMMU_PAGE_FAULT" },
+    { 0x0000015A, L"SDBUS_INTERNAL_ERROR" },
+    { 0x0000015B, L"WORKER_THREAD_RETURNED_WITH_SYSTEM_PAGE_PRIORITY_ACTIVE" },
+    { 0x00000160, L"WIN32K_ATOMIC_CHECK_FAILURE" },
+    { 0x00000162, L"KERNEL_AUTO_BOOST_INVALID_LOCK_RELEASE" },
+    { 0x00000163, L"WORKER_THREAD_TEST_CONDITION" },
+    { 0x00000164, L"WIN32K_CRITICAL_FAILURE" },
+    { 0x0000016C, L"INVALID_RUNDOWN_PROTECTION_FLAGS" },
+    { 0x0000016D, L"INVALID_SLOT_ALLOCATOR_FLAGS" },
+    { 0x0000016E, L"ERESOURCE_INVALID_RELEASE" },
+    { 0x00000170, L"CLUSTER_CSV_CLUSSVC_DISCONNECT_WATCHDOG" },
+    { 0x00000171, L"CRYPTO_LIBRARY_INTERNAL_ERROR" },
+    { 0x00000173, L"COREMSGCALL_INTERNAL_ERROR" },
+    { 0x00000174, L"COREMSG_INTERNAL_ERROR" },
+    { 0x00000178, L"ELAM_DRIVER_DETECTED_FATAL_ERROR" },
+    { 0x0000017B, L"PROFILER_CONFIGURATION_ILLEGAL" },
+    { 0x0000017E, L"MICROCODE_REVISION_MISMATCH" },
+    { 0x00000187, L"VIDEO_DWMINIT_TIMEOUT_FALLBACK_BDD" },
+    { 0x00000189, L"BAD_OBJECT_HEADER" },
+    { 0x0000018B, L"SECURE_KERNEL_ERROR" },
+    { 0x0000018C, L"HYPERGUARD_VIOLATION" },
+    { 0x0000018D, L"SECURE_FAULT_UNHANDLED" },
+    { 0x0000018E, L"KERNEL_PARTITION_REFERENCE_VIOLATION" },
+    { 0x00000191, L"PF_DETECTED_CORRUPTION" },
+    { 0x00000192, L"KERNEL_AUTO_BOOST_LOCK_ACQUISITION_WITH_RAISED_IRQL" },
+    { 0x00000196, L"LOADER_ROLLBACK_DETECTED" },
+    { 0x00000197, L"WIN32K_SECURITY_FAILURE" },
+    { 0x00000199, L"KERNEL_STORAGE_SLOT_IN_USE" },
+    { 0x0000019A, L"WORKER_THREAD_RETURNED_WHILE_ATTACHED_TO_SILO" },
+    { 0x0000019B, L"TTM_FATAL_ERROR" },
+    { 0x0000019C, L"WIN32K_POWER_WATCHDOG_TIMEOUT" },
+    { 0x000001A0, L"TTM_WATCHDOG_TIMEOUT" },
+    { 0x000001A2, L"WIN32K_CALLOUT_WATCHDOG_BUGCHECK" },
+    { 0x000001AA, L"EXCEPTION_ON_INVALID_STACK" },
+    { 0x000001AB, L"UNWIND_ON_INVALID_STACK" },
+    { 0x000001C6, L"FAST_ERESOURCE_PRECONDITION_VIOLATION" },
+    { 0x000001C7, L"STORE_DATA_STRUCTURE_CORRUPTION" },
+    { 0x000001C8, L"MANUALLY_INITIATED_POWER_BUTTON_HOLD" },
+    { 0x000001CA, L"SYNTHETIC_WATCHDOG_TIMEOUT" },
+    { 0x000001CB, L"INVALID_SILO_DETACH" },
+    { 0x000001CD, L"INVALID_CALLBACK_STACK_ADDRESS" },
+    { 0x000001CE, L"INVALID_KERNEL_STACK_ADDRESS" },
+    { 0x000001CF, L"HARDWARE_WATCHDOG_TIMEOUT" },
+    { 0x000001D0, L"CPI_FIRMWARE_WATCHDOG_TIMEOUT" },
+    { 0x000001D2, L"WORKER_THREAD_INVALID_STATE" },
+    { 0x000001D3, L"WFP_INVALID_OPERATION" },
+    { 0x000001D5, L"DRIVER_PNP_WATCHDOG" },
+    { 0x000001D6, L"WORKER_THREAD_RETURNED_WITH_NON_DEFAULT_WORKLOAD_CLASS" },
+    { 0x000001D7, L"EFS_FATAL_ERROR" },
+    { 0x000001D8, L"UCMUCSI_FAILURE" },
+    { 0x000001D9, L"HAL_IOMMU_INTERNAL_ERROR" },
+    { 0x000001DA, L"HAL_BLOCKED_PROCESSOR_INTERNAL_ERROR" },
+    { 0x000001DB, L"IPI_WATCHDOG_TIMEOUT" },
+    { 0x000001DC, L"DMA_COMMON_BUFFER_VECTOR_ERROR" },
+    { 0x000001DD, L"BUGCODE_MBBADAPTER_DRIVER" },
+    { 0x000001DE, L"BUGCODE_WIFIADAPTER_DRIVER" },
+    { 0x000001DF, L"PROCESSOR_START_TIMEOUT" },
+    { 0x000001E4, L"VIDEO_DXGKRNL_SYSMM_FATAL_ERROR" },
+    { 0x000001E9, L"ILLEGAL_ATS_INITIALIZATION" },
+    { 0x000001EA, L"SECURE_PCI_CONFIG_SPACE_ACCESS_VIOLATION" },
+    { 0x000001EB, L"DAM_WATCHDOG_TIMEOUT" },
+    { 0x000001ED, L"HANDLE_ERROR_ON_CRITICAL_THREAD" },
+    { 0x00000356, L"XBOX_ERACTRL_CS_TIMEOUT" },
+    { 0x00000BFE, L"BC_BLUETOOTH_VERIFIER_FAULT" },
+    { 0x00000BFF, L"BC_BTHMINI_VERIFIER_FAULT" },
+    { 0x00020001, L"HYPERVISOR_ERROR" },
+    { 0x1000007E, L"SYSTEM_THREAD_EXCEPTION_NOT_HANDLED_M" },
+    { 0x1000007F, L"UNEXPECTED_KERNEL_MODE_TRAP_M" },
+    { 0x1000008E, L"KERNEL_MODE_EXCEPTION_NOT_HANDLED_M" },
+    { 0x100000EA, L"THREAD_STUCK_IN_DEVICE_DRIVER_M" },
+    { 0x4000008A, L"THREAD_TERMINATE_HELD_MUTEX" },
+    { 0xC0000218, L"STATUS_CANNOT_LOAD_REGISTRY_FILE" },
+    { 0xC000021A, L"WINLOGON_FATAL_ERROR" },
+    { 0xC0000221, L"STATUS_IMAGE_CHECKSUM_MISMATCH" },
+    { 0xDEADDEAD, L"MANUALLY_INITIATED_CRASH1" },
+};
+
+#define INTERNET_ERROR_BASE 12000
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Table:    c_aWininetCodes
+
+  Summary:  Error code definitions for Wininet
+            Based on C:\Program Files (x86)\Windows Kits\10\Include\10.0.26100.0\um\wininet.h
+
+            Q&D:
+            Search #define *(\S*)\s*\((.*)\)$
+            Replace { \2, L"\1" },
+-------------------------------------------------------------------*/
+constexpr ErrorCodeEntry c_aWininetCodes[] = {
+    { INTERNET_ERROR_BASE + 1, L"ERROR_INTERNET_OUT_OF_HANDLES" },
+    { INTERNET_ERROR_BASE + 2, L"ERROR_INTERNET_TIMEOUT" },
+    { INTERNET_ERROR_BASE + 3, L"ERROR_INTERNET_EXTENDED_ERROR" },
+    { INTERNET_ERROR_BASE + 4, L"ERROR_INTERNET_INTERNAL_ERROR" },
+    { INTERNET_ERROR_BASE + 5, L"ERROR_INTERNET_INVALID_URL" },
+    { INTERNET_ERROR_BASE + 6, L"ERROR_INTERNET_UNRECOGNIZED_SCHEME" },
+    { INTERNET_ERROR_BASE + 7, L"ERROR_INTERNET_NAME_NOT_RESOLVED" },
+    { INTERNET_ERROR_BASE + 8, L"ERROR_INTERNET_PROTOCOL_NOT_FOUND" },
+    { INTERNET_ERROR_BASE + 9, L"ERROR_INTERNET_INVALID_OPTION" },
+    { INTERNET_ERROR_BASE + 10, L"ERROR_INTERNET_BAD_OPTION_LENGTH" },
+    { INTERNET_ERROR_BASE + 11, L"ERROR_INTERNET_OPTION_NOT_SETTABLE" },
+    { INTERNET_ERROR_BASE + 12, L"ERROR_INTERNET_SHUTDOWN" },
+    { INTERNET_ERROR_BASE + 13, L"ERROR_INTERNET_INCORRECT_USER_NAME" },
+    { INTERNET_ERROR_BASE + 14, L"ERROR_INTERNET_INCORRECT_PASSWORD" },
+    { INTERNET_ERROR_BASE + 15, L"ERROR_INTERNET_LOGIN_FAILURE" },
+    { INTERNET_ERROR_BASE + 16, L"ERROR_INTERNET_INVALID_OPERATION" },
+    { INTERNET_ERROR_BASE + 17, L"ERROR_INTERNET_OPERATION_CANCELLED" },
+    { INTERNET_ERROR_BASE + 18, L"ERROR_INTERNET_INCORRECT_HANDLE_TYPE" },
+    { INTERNET_ERROR_BASE + 19, L"ERROR_INTERNET_INCORRECT_HANDLE_STATE" },
+    { INTERNET_ERROR_BASE + 20, L"ERROR_INTERNET_NOT_PROXY_REQUEST" },
+    { INTERNET_ERROR_BASE + 21, L"ERROR_INTERNET_REGISTRY_VALUE_NOT_FOUND" },
+    { INTERNET_ERROR_BASE + 22, L"ERROR_INTERNET_BAD_REGISTRY_PARAMETER" },
+    { INTERNET_ERROR_BASE + 23, L"ERROR_INTERNET_NO_DIRECT_ACCESS" },
+    { INTERNET_ERROR_BASE + 24, L"ERROR_INTERNET_NO_CONTEXT" },
+    { INTERNET_ERROR_BASE + 25, L"ERROR_INTERNET_NO_CALLBACK" },
+    { INTERNET_ERROR_BASE + 26, L"ERROR_INTERNET_REQUEST_PENDING" },
+    { INTERNET_ERROR_BASE + 27, L"ERROR_INTERNET_INCORRECT_FORMAT" },
+    { INTERNET_ERROR_BASE + 28, L"ERROR_INTERNET_ITEM_NOT_FOUND" },
+    { INTERNET_ERROR_BASE + 29, L"ERROR_INTERNET_CANNOT_CONNECT" },
+    { INTERNET_ERROR_BASE + 30, L"ERROR_INTERNET_CONNECTION_ABORTED" },
+    { INTERNET_ERROR_BASE + 31, L"ERROR_INTERNET_CONNECTION_RESET" },
+    { INTERNET_ERROR_BASE + 32, L"ERROR_INTERNET_FORCE_RETRY" },
+    { INTERNET_ERROR_BASE + 33, L"ERROR_INTERNET_INVALID_PROXY_REQUEST" },
+    { INTERNET_ERROR_BASE + 34, L"ERROR_INTERNET_NEED_UI" },
+
+    { INTERNET_ERROR_BASE + 36, L"ERROR_INTERNET_HANDLE_EXISTS" },
+    { INTERNET_ERROR_BASE + 37, L"ERROR_INTERNET_SEC_CERT_DATE_INVALID" },
+    { INTERNET_ERROR_BASE + 38, L"ERROR_INTERNET_SEC_CERT_CN_INVALID" },
+    { INTERNET_ERROR_BASE + 39, L"ERROR_INTERNET_HTTP_TO_HTTPS_ON_REDIR" },
+    { INTERNET_ERROR_BASE + 40, L"ERROR_INTERNET_HTTPS_TO_HTTP_ON_REDIR" },
+    { INTERNET_ERROR_BASE + 41, L"ERROR_INTERNET_MIXED_SECURITY" },
+    { INTERNET_ERROR_BASE + 42, L"ERROR_INTERNET_CHG_POST_IS_NON_SECURE" },
+    { INTERNET_ERROR_BASE + 43, L"ERROR_INTERNET_POST_IS_NON_SECURE" },
+    { INTERNET_ERROR_BASE + 44, L"ERROR_INTERNET_CLIENT_AUTH_CERT_NEEDED" },
+    { INTERNET_ERROR_BASE + 45, L"ERROR_INTERNET_INVALID_CA" },
+    { INTERNET_ERROR_BASE + 46, L"ERROR_INTERNET_CLIENT_AUTH_NOT_SETUP" },
+    { INTERNET_ERROR_BASE + 47, L"ERROR_INTERNET_ASYNC_THREAD_FAILED" },
+    { INTERNET_ERROR_BASE + 48, L"ERROR_INTERNET_REDIRECT_SCHEME_CHANGE" },
+    { INTERNET_ERROR_BASE + 49, L"ERROR_INTERNET_DIALOG_PENDING" },
+    { INTERNET_ERROR_BASE + 50, L"ERROR_INTERNET_RETRY_DIALOG" },
+    { INTERNET_ERROR_BASE + 52, L"ERROR_INTERNET_HTTPS_HTTP_SUBMIT_REDIR" },
+    { INTERNET_ERROR_BASE + 53, L"ERROR_INTERNET_INSERT_CDROM" },
+    { INTERNET_ERROR_BASE + 54, L"ERROR_INTERNET_FORTEZZA_LOGIN_NEEDED" },
+    { INTERNET_ERROR_BASE + 55, L"ERROR_INTERNET_SEC_CERT_ERRORS" },
+    { INTERNET_ERROR_BASE + 56, L"ERROR_INTERNET_SEC_CERT_NO_REV" },
+    { INTERNET_ERROR_BASE + 57, L"ERROR_INTERNET_SEC_CERT_REV_FAILED" },
+
+
+    { INTERNET_ERROR_BASE + 60, L"ERROR_HTTP_HSTS_REDIRECT_REQUIRED" },
+
+
+    { INTERNET_ERROR_BASE + 62, L"ERROR_INTERNET_SEC_CERT_WEAK_SIGNATURE" },
+
+
+    //
+    // FTP API errors
+    //
+
+    { INTERNET_ERROR_BASE + 110, L"ERROR_FTP_TRANSFER_IN_PROGRESS\r\n(FTP API error)" },
+    { INTERNET_ERROR_BASE + 111, L"ERROR_FTP_DROPPED\r\n(FTP API error)" },
+    { INTERNET_ERROR_BASE + 112, L"ERROR_FTP_NO_PASSIVE_MODE\r\n(FTP API error)" },
+
+    //
+    // gopher API errors
+    //
+
+    { INTERNET_ERROR_BASE + 130, L"ERROR_GOPHER_PROTOCOL_ERROR\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 131, L"ERROR_GOPHER_NOT_FILE\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 132, L"ERROR_GOPHER_DATA_ERROR\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 133, L"ERROR_GOPHER_END_OF_DATA\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 134, L"ERROR_GOPHER_INVALID_LOCATOR\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 135, L"ERROR_GOPHER_INCORRECT_LOCATOR_TYPE\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 136, L"ERROR_GOPHER_NOT_GOPHER_PLUS\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 137, L"ERROR_GOPHER_ATTRIBUTE_NOT_FOUND\r\n(gopher API error)" },
+    { INTERNET_ERROR_BASE + 138, L"ERROR_GOPHER_UNKNOWN_LOCATOR\r\n(gopher API error)" },
+
+    //
+    // HTTP API errors
+    //
+
+    { INTERNET_ERROR_BASE + 150, L"ERROR_HTTP_HEADER_NOT_FOUND\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 151, L"ERROR_HTTP_DOWNLEVEL_SERVER\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 152, L"ERROR_HTTP_INVALID_SERVER_RESPONSE\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 153, L"ERROR_HTTP_INVALID_HEADER\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 154, L"ERROR_HTTP_INVALID_QUERY_REQUEST\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 155, L"ERROR_HTTP_HEADER_ALREADY_EXISTS\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 156, L"ERROR_HTTP_REDIRECT_FAILED\r\n(HTTP API error)" },
+
+    //
+    // additional Internet API error codes
+    //
+
+    { INTERNET_ERROR_BASE + 157, L"ERROR_INTERNET_SECURITY_CHANNEL_ERROR\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 158, L"ERROR_INTERNET_UNABLE_TO_CACHE_FILE\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 159, L"ERROR_INTERNET_TCPIP_NOT_INSTALLED\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 160, L"ERROR_HTTP_NOT_REDIRECTED\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 161, L"ERROR_HTTP_COOKIE_NEEDS_CONFIRMATION\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 162, L"ERROR_HTTP_COOKIE_DECLINED\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 163, L"ERROR_INTERNET_DISCONNECTED\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 164, L"ERROR_INTERNET_SERVER_UNREACHABLE\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 165, L"ERROR_INTERNET_PROXY_SERVER_UNREACHABLE\r\n(Internet API error)" },
+
+    { INTERNET_ERROR_BASE + 166, L"ERROR_INTERNET_BAD_AUTO_PROXY_SCRIPT\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 167, L"ERROR_INTERNET_UNABLE_TO_DOWNLOAD_SCRIPT\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 168, L"ERROR_HTTP_REDIRECT_NEEDS_CONFIRMATION\r\n(HTTP API error)" },
+    { INTERNET_ERROR_BASE + 169, L"ERROR_INTERNET_SEC_INVALID_CERT\r\n(Internet API error)" },
+    { INTERNET_ERROR_BASE + 170, L"ERROR_INTERNET_SEC_CERT_REVOKED\r\n(Internet API error)" },
+
+    // InternetAutodial specific errors
+
+    { INTERNET_ERROR_BASE + 171, L"ERROR_INTERNET_FAILED_DUETOSECURITYCHECK\r\n(InternetAutodial specific error)" },
+    { INTERNET_ERROR_BASE + 172, L"ERROR_INTERNET_NOT_INITIALIZED\r\n(InternetAutodial specific error)" },
+    { INTERNET_ERROR_BASE + 173, L"ERROR_INTERNET_NEED_MSN_SSPI_PKG\r\n(InternetAutodial specific error)" },
+    { INTERNET_ERROR_BASE + 174, L"ERROR_INTERNET_LOGIN_FAILURE_DISPLAY_ENTITY_BODY\r\n(InternetAutodial specific error)" },
+
+    // Decoding/Decompression specific errors
+
+    { INTERNET_ERROR_BASE + 175, L"ERROR_INTERNET_DECODING_FAILED\r\n(Decoding/Decompression specific error)" },
+
+    { INTERNET_ERROR_BASE + 187, L"ERROR_INTERNET_CLIENT_AUTH_CERT_NEEDED_PROXY\r\n(Decoding/Decompression specific error)" },
+    { INTERNET_ERROR_BASE + 188, L"ERROR_INTERNET_SECURE_FAILURE_PROXY\r\n(Decoding/Decompression specific error)" },
+    { INTERNET_ERROR_BASE + 190, L"ERROR_INTERNET_HTTP_PROTOCOL_MISMATCH\r\n(Decoding/Decompression specific error)" },
+    { INTERNET_ERROR_BASE + 191, L"ERROR_INTERNET_GLOBAL_CALLBACK_FAILED\r\n(Decoding/Decompression specific error)" },
+    { INTERNET_ERROR_BASE + 192, L"ERROR_INTERNET_FEATURE_DISABLED\r\n(Decoding/Decompression specific error)" },
+
+    // { INTERNET_ERROR_BASE + 192, L"INTERNET_ERROR_LAST" }, // Seems to be a duplicate code in wininet.h 
+};
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Table:    c_aLDAPCodes
+
+  Summary:  Error code definitions for LDAP
+            Based on C:\Program Files (x86)\Windows Kits\10\Include\10.0.26100.0\um\Winldap.h
+
+            Q&D:
+            Search \s*(\S*)\s*=\s*(.*),$
+            Replace { \2, L"\1" },\n
+-------------------------------------------------------------------*/
+constexpr ErrorCodeEntry c_aLDAPCodes[] = {
+    { 0x00, L"LDAP_SUCCESS" },
+    { 0x01, L"LDAP_OPERATIONS_ERROR" },
+    { 0x02, L"LDAP_PROTOCOL_ERROR" },
+    { 0x03, L"LDAP_TIMELIMIT_EXCEEDED" },
+    { 0x04, L"LDAP_SIZELIMIT_EXCEEDED" },
+    { 0x05, L"LDAP_COMPARE_FALSE" },
+    { 0x06, L"LDAP_COMPARE_TRUE" },
+    { 0x07, L"LDAP_AUTH_METHOD_NOT_SUPPORTED" },
+    { 0x08, L"LDAP_STRONG_AUTH_REQUIRED" },
+    // { 0x09, L"LDAP_REFERRAL_V2" }, // Duplicate code in Winldap.h
+    { 0x09, L"LDAP_PARTIAL_RESULTS" },
+    { 0x0a, L"LDAP_REFERRAL" },
+    { 0x0b, L"LDAP_ADMIN_LIMIT_EXCEEDED" },
+    { 0x0c, L"LDAP_UNAVAILABLE_CRIT_EXTENSION" },
+    { 0x0d, L"LDAP_CONFIDENTIALITY_REQUIRED" },
+    { 0x0e, L"LDAP_SASL_BIND_IN_PROGRESS" },
+    { 0x10, L"LDAP_NO_SUCH_ATTRIBUTE" },
+    { 0x11, L"LDAP_UNDEFINED_TYPE" },
+    { 0x12, L"LDAP_INAPPROPRIATE_MATCHING" },
+    { 0x13, L"LDAP_CONSTRAINT_VIOLATION" },
+    { 0x14, L"LDAP_ATTRIBUTE_OR_VALUE_EXISTS" },
+    { 0x15, L"LDAP_INVALID_SYNTAX" },
+    { 0x20, L"LDAP_NO_SUCH_OBJECT" },
+    { 0x21, L"LDAP_ALIAS_PROBLEM" },
+    { 0x22, L"LDAP_INVALID_DN_SYNTAX" },
+    { 0x23, L"LDAP_IS_LEAF" },
+    { 0x24, L"LDAP_ALIAS_DEREF_PROBLEM" },
+    { 0x30, L"LDAP_INAPPROPRIATE_AUTH" },
+    { 0x31, L"LDAP_INVALID_CREDENTIALS" },
+    { 0x32, L"LDAP_INSUFFICIENT_RIGHTS" },
+    { 0x33, L"LDAP_BUSY" },
+    { 0x34, L"LDAP_UNAVAILABLE" },
+    { 0x35, L"LDAP_UNWILLING_TO_PERFORM" },
+    { 0x36, L"LDAP_LOOP_DETECT" },
+    { 0x3C, L"LDAP_SORT_CONTROL_MISSING" },
+    { 0x3D, L"LDAP_OFFSET_RANGE_ERROR" },
+    { 0x40, L"LDAP_NAMING_VIOLATION" },
+    { 0x41, L"LDAP_OBJECT_CLASS_VIOLATION" },
+    { 0x42, L"LDAP_NOT_ALLOWED_ON_NONLEAF" },
+    { 0x43, L"LDAP_NOT_ALLOWED_ON_RDN" },
+    { 0x44, L"LDAP_ALREADY_EXISTS" },
+    { 0x45, L"LDAP_NO_OBJECT_CLASS_MODS" },
+    { 0x46, L"LDAP_RESULTS_TOO_LARGE" },
+    { 0x47, L"LDAP_AFFECTS_MULTIPLE_DSAS" },
+    { 0x4c, L"LDAP_VIRTUAL_LIST_VIEW_ERROR" },
+    { 0x50, L"LDAP_OTHER" },
+    { 0x51, L"LDAP_SERVER_DOWN" },
+    { 0x52, L"LDAP_LOCAL_ERROR" },
+    { 0x53, L"LDAP_ENCODING_ERROR" },
+    { 0x54, L"LDAP_DECODING_ERROR" },
+    { 0x55, L"LDAP_TIMEOUT" },
+    { 0x56, L"LDAP_AUTH_UNKNOWN" },
+    { 0x57, L"LDAP_FILTER_ERROR" },
+    { 0x58, L"LDAP_USER_CANCELLED" },
+    { 0x59, L"LDAP_PARAM_ERROR" },
+    { 0x5a, L"LDAP_NO_MEMORY" },
+    { 0x5b, L"LDAP_CONNECT_ERROR" },
+    { 0x5c, L"LDAP_NOT_SUPPORTED" },
+    { 0x5d, L"LDAP_CONTROL_NOT_FOUND" },
+    { 0x5e, L"LDAP_NO_RESULTS_RETURNED" },
+    { 0x5f, L"LDAP_MORE_RESULTS_TO_RETURN" },
+    { 0x60, L"LDAP_CLIENT_LOOP" },
+    { 0x61, L"LDAP_REFERRAL_LIMIT_EXCEEDED" },
+};
+
+/*+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Table:    c_aWUCodes
+
+  Summary:  Error code definitions for Windows Update
+            Based on C:\Program Files (x86)\Windows Kits\10\Include\10.0.26100.0\um\wuerror.h
+
+            Q&D:
+            Search \r\n^//.*$\r\n^.*MessageID: (.*)$\r\n^//.*$\r\n^//.*$\r\n^//.*$\r\n^// (.*)$\r\n^//.*$\r\n^.*_HRESULT_TYPEDEF_\((.*)\)$
+            Replace { \3, L"\1\\r\\n\(\2\)" },
+
+            Entries are sorted by code, so some of the wuerror.h sections
+            appear in a different order than in the header file
+-------------------------------------------------------------------*/
+constexpr ErrorCodeEntry c_aWUCodes[] = {
+    //
+    // Define the severity codes
+    //
+
+    { 0x00240001L, L"WU_S_SERVICE_STOP\r\n(Windows Update Agent was stopped successfully)" },
+    { 0x00240002L, L"WU_S_SELFUPDATE\r\n(Windows Update Agent updated itself)" },
+    { 0x00240003L, L"WU_S_UPDATE_ERROR\r\n(Operation completed successfully but there were errors applying the updates)" },
+    { 0x00240004L, L"WU_S_MARKED_FOR_DISCONNECT\r\n(A callback was marked to be disconnected later because the request to disconnect the operation came while a callback was executing)" },
+    { 0x00240005L, L"WU_S_REBOOT_REQUIRED\r\n(The system must be restarted to complete installation of the update)" },
+    { 0x00240006L, L"WU_S_ALREADY_INSTALLED\r\n(The update to be installed is already installed on the system)" },
+    { 0x00240007L, L"WU_S_ALREADY_UNINSTALLED\r\n(The update to be removed is not installed on the system)" },
+    { 0x00240008L, L"WU_S_ALREADY_DOWNLOADED\r\n(The update to be downloaded has already been downloaded)" },
+    { 0x00240009L, L"WU_S_SOME_UPDATES_SKIPPED_ON_BATTERY\r\n(The operation completed successfully, but some updates were skipped because the system is running on batteries)" },
+    { 0x0024000AL, L"WU_S_ALREADY_REVERTED\r\n(The update to be reverted is not present on the system)" },
+    { 0x00240010L, L"WU_S_SEARCH_CRITERIA_NOT_SUPPORTED\r\n(The operation is skipped because the update service does not support the requested search criteria)" },
+    { 0x00242015L, L"WU_S_UH_INSTALLSTILLPENDING\r\n(The installation operation for the update is still in progress)" },
+    { 0x00242016L, L"WU_S_UH_DOWNLOAD_SIZE_CALCULATED\r\n(The actual download size has been calculated by the handler)" },
+    { 0x00245001L, L"WU_S_SIH_NOOP\r\n(No operation was required by the server-initiated healing server response)" },
+    { 0x00246001L, L"WU_S_DM_ALREADYDOWNLOADING\r\n(The update to be downloaded is already being downloaded)" },
+    { 0x00247101L, L"WU_S_METADATA_SKIPPED_BY_ENFORCEMENTMODE\r\n(Metadata verification was skipped by enforcement mode)" },
+    { 0x00247102L, L"WU_S_METADATA_IGNORED_SIGNATURE_VERIFICATION\r\n(A server configuration refresh resulted in metadata signature verification to be ignored)" },
+    { 0x00248001L, L"WU_S_SEARCH_LOAD_SHEDDING\r\n(Search operation completed successfully but one or more services were shedding load)" },
+    { 0x00248002L, L"WU_S_AAD_DEVICE_TICKET_NOT_NEEDED\r\n(There was no need to retrieve an AAD device ticket)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Windows Update Error Codes
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80240001L, L"WU_E_NO_SERVICE\r\n(Windows Update Agent was unable to provide the service)" },
+    { 0x80240002L, L"WU_E_MAX_CAPACITY_REACHED\r\n(The maximum capacity of the service was exceeded)" },
+    { 0x80240003L, L"WU_E_UNKNOWN_ID\r\n(An ID cannot be found)" },
+    { 0x80240004L, L"WU_E_NOT_INITIALIZED\r\n(The object could not be initialized)" },
+    { 0x80240005L, L"WU_E_RANGEOVERLAP\r\n(The update handler requested a byte range overlapping a previously requested range)" },
+    { 0x80240006L, L"WU_E_TOOMANYRANGES\r\n(The requested number of byte ranges exceeds the maximum number (2^31 - 1))" },
+    { 0x80240007L, L"WU_E_INVALIDINDEX\r\n(The index to a collection was invalid)" },
+    { 0x80240008L, L"WU_E_ITEMNOTFOUND\r\n(The key for the item queried could not be found)" },
+    { 0x80240009L, L"WU_E_OPERATIONINPROGRESS\r\n(Another conflicting operation was in progress. Some operations such as installation cannot be performed twice simultaneously)" },
+    { 0x8024000AL, L"WU_E_COULDNOTCANCEL\r\n(Cancellation of the operation was not allowed)" },
+    { 0x8024000BL, L"WU_E_CALL_CANCELLED\r\n(Operation was cancelled)" },
+    { 0x8024000CL, L"WU_E_NOOP\r\n(No operation was required)" },
+    { 0x8024000DL, L"WU_E_XML_MISSINGDATA\r\n(Windows Update Agent could not find required information in the update's XML data)" },
+    { 0x8024000EL, L"WU_E_XML_INVALID\r\n(Windows Update Agent found invalid information in the update's XML data)" },
+    { 0x8024000FL, L"WU_E_CYCLE_DETECTED\r\n(Circular update relationships were detected in the metadata)" },
+    { 0x80240010L, L"WU_E_TOO_DEEP_RELATION\r\n(Update relationships too deep to evaluate were evaluated)" },
+    { 0x80240011L, L"WU_E_INVALID_RELATIONSHIP\r\n(An invalid update relationship was detected)" },
+    { 0x80240012L, L"WU_E_REG_VALUE_INVALID\r\n(An invalid registry value was read)" },
+    { 0x80240013L, L"WU_E_DUPLICATE_ITEM\r\n(Operation tried to add a duplicate item to a list)" },
+    { 0x80240014L, L"WU_E_INVALID_INSTALL_REQUESTED\r\n(Updates requested for install are not installable by caller)" },
+    { 0x80240016L, L"WU_E_INSTALL_NOT_ALLOWED\r\n(Operation tried to install while another installation was in progress or the system was pending a mandatory restart)" },
+    { 0x80240017L, L"WU_E_NOT_APPLICABLE\r\n(Operation was not performed because there are no applicable updates)" },
+    { 0x80240018L, L"WU_E_NO_USERTOKEN\r\n(Operation failed because a required user token is missing)" },
+    { 0x80240019L, L"WU_E_EXCLUSIVE_INSTALL_CONFLICT\r\n(An exclusive update cannot be installed with other updates at the same time)" },
+    { 0x8024001AL, L"WU_E_POLICY_NOT_SET\r\n(A policy value was not set)" },
+    { 0x8024001BL, L"WU_E_SELFUPDATE_IN_PROGRESS\r\n(The operation could not be performed because the Windows Update Agent is self-updating)" },
+    { 0x8024001DL, L"WU_E_INVALID_UPDATE\r\n(An update contains invalid metadata)" },
+    { 0x8024001EL, L"WU_E_SERVICE_STOP\r\n(Operation did not complete because the service or system was being shut down)" },
+    { 0x8024001FL, L"WU_E_NO_CONNECTION\r\n(Operation did not complete because the network connection was unavailable)" },
+    { 0x80240020L, L"WU_E_NO_INTERACTIVE_USER\r\n(Operation did not complete because there is no logged-on interactive user)" },
+    { 0x80240021L, L"WU_E_TIME_OUT\r\n(Operation did not complete because it timed out)" },
+    { 0x80240022L, L"WU_E_ALL_UPDATES_FAILED\r\n(Operation failed for all the updates)" },
+    { 0x80240023L, L"WU_E_EULAS_DECLINED\r\n(The license terms for all updates were declined)" },
+    { 0x80240024L, L"WU_E_NO_UPDATE\r\n(There are no updates)" },
+    { 0x80240025L, L"WU_E_USER_ACCESS_DISABLED\r\n(Group Policy settings prevented access to Windows Update)" },
+    { 0x80240026L, L"WU_E_INVALID_UPDATE_TYPE\r\n(The type of update is invalid)" },
+    { 0x80240027L, L"WU_E_URL_TOO_LONG\r\n(The URL exceeded the maximum length)" },
+    { 0x80240028L, L"WU_E_UNINSTALL_NOT_ALLOWED\r\n(The update could not be uninstalled because the request did not originate from a WSUS server)" },
+    { 0x80240029L, L"WU_E_INVALID_PRODUCT_LICENSE\r\n(Search may have missed some updates before there is an unlicensed application on the system)" },
+    { 0x8024002AL, L"WU_E_MISSING_HANDLER\r\n(A component required to detect applicable updates was missing)" },
+    { 0x8024002BL, L"WU_E_LEGACYSERVER\r\n(An operation did not complete because it requires a newer version of server)" },
+    { 0x8024002CL, L"WU_E_BIN_SOURCE_ABSENT\r\n(A delta-compressed update could not be installed because it required the source)" },
+    { 0x8024002DL, L"WU_E_SOURCE_ABSENT\r\n(A full-file update could not be installed because it required the source)" },
+    { 0x8024002EL, L"WU_E_WU_DISABLED\r\n(Access to an unmanaged server is not allowed)" },
+    { 0x8024002FL, L"WU_E_CALL_CANCELLED_BY_POLICY\r\n(Operation did not complete because the DisableWindowsUpdateAccess policy was set)" },
+    { 0x80240030L, L"WU_E_INVALID_PROXY_SERVER\r\n(The format of the proxy list was invalid)" },
+    { 0x80240031L, L"WU_E_INVALID_FILE\r\n(The file is in the wrong format)" },
+    { 0x80240032L, L"WU_E_INVALID_CRITERIA\r\n(The search criteria string was invalid)" },
+    { 0x80240033L, L"WU_E_EULA_UNAVAILABLE\r\n(License terms could not be downloaded)" },
+    { 0x80240034L, L"WU_E_DOWNLOAD_FAILED\r\n(Update failed to download)" },
+    { 0x80240035L, L"WU_E_UPDATE_NOT_PROCESSED\r\n(The update was not processed)" },
+    { 0x80240036L, L"WU_E_INVALID_OPERATION\r\n(The object's current state did not allow the operation)" },
+    { 0x80240037L, L"WU_E_NOT_SUPPORTED\r\n(The functionality for the operation is not supported)" },
+    { 0x80240038L, L"WU_E_WINHTTP_INVALID_FILE\r\n(The downloaded file has an unexpected content type)" },
+    { 0x80240039L, L"WU_E_TOO_MANY_RESYNC\r\n(Agent is asked by server to resync too many times)" },
+    { 0x80240040L, L"WU_E_NO_SERVER_CORE_SUPPORT\r\n(WUA API method does not run on Server Core installation)" },
+    { 0x80240041L, L"WU_E_SYSPREP_IN_PROGRESS\r\n(Service is not available while sysprep is running)" },
+    { 0x80240042L, L"WU_E_UNKNOWN_SERVICE\r\n(The update service is no longer registered with AU)" },
+    { 0x80240043L, L"WU_E_NO_UI_SUPPORT\r\n(There is no support for WUA UI)" },
+    { 0x80240044L, L"WU_E_PER_MACHINE_UPDATE_ACCESS_DENIED\r\n(Only administrators can perform this operation on per-machine updates)" },
+    { 0x80240045L, L"WU_E_UNSUPPORTED_SEARCHSCOPE\r\n(A search was attempted with a scope that is not currently supported for this type of search)" },
+    { 0x80240046L, L"WU_E_BAD_FILE_URL\r\n(The URL does not point to a file)" },
+    { 0x80240047L, L"WU_E_REVERT_NOT_ALLOWED\r\n(The update could not be reverted)" },
+    { 0x80240048L, L"WU_E_INVALID_NOTIFICATION_INFO\r\n(The featured update notification info returned by the server is invalid)" },
+    { 0x80240049L, L"WU_E_OUTOFRANGE\r\n(The data is out of range)" },
+    { 0x8024004AL, L"WU_E_SETUP_IN_PROGRESS\r\n(Windows Update agent operations are not available while OS setup is running)" },
+    { 0x8024004BL, L"WU_E_ORPHANED_DOWNLOAD_JOB\r\n(An orphaned downloadjob was found with no active callers)" },
+    { 0x8024004CL, L"WU_E_LOW_BATTERY\r\n(An update could not be installed because the system battery power level is too low)" },
+    { 0x8024004DL, L"WU_E_INFRASTRUCTUREFILE_INVALID_FORMAT\r\n(The downloaded infrastructure file is incorrectly formatted)" },
+    { 0x8024004EL, L"WU_E_INFRASTRUCTUREFILE_REQUIRES_SSL\r\n(The infrastructure file must be downloaded using strong SSL)" },
+    { 0x8024004FL, L"WU_E_IDLESHUTDOWN_OPCOUNT_DISCOVERY\r\n(A discovery call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240050L, L"WU_E_IDLESHUTDOWN_OPCOUNT_SEARCH\r\n(A search call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240051L, L"WU_E_IDLESHUTDOWN_OPCOUNT_DOWNLOAD\r\n(A download call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240052L, L"WU_E_IDLESHUTDOWN_OPCOUNT_INSTALL\r\n(An install call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240053L, L"WU_E_IDLESHUTDOWN_OPCOUNT_OTHER\r\n(An unspecified call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240054L, L"WU_E_INTERACTIVE_CALL_CANCELLED\r\n(An interactive user cancelled this operation, which was started from the Windows Update Agent UI)" },
+    { 0x80240055L, L"WU_E_AU_CALL_CANCELLED\r\n(Automatic Updates cancelled this operation because it applies to an update that is no longer applicable to this computer)" },
+    { 0x80240056L, L"WU_E_SYSTEM_UNSUPPORTED\r\n(This version or edition of the operating system doesn't support the needed functionality)" },
+    { 0x80240057L, L"WU_E_NO_SUCH_HANDLER_PLUGIN\r\n(The requested update download or install handler, or update applicability expression evaluator, is not provided by this Agent plugin)" },
+    { 0x80240058L, L"WU_E_INVALID_SERIALIZATION_VERSION\r\n(The requested serialization version is not supported)" },
+    { 0x80240059L, L"WU_E_NETWORK_COST_EXCEEDS_POLICY\r\n(The current network cost does not meet the conditions set by the network cost policy)" },
+    { 0x8024005AL, L"WU_E_CALL_CANCELLED_BY_HIDE\r\n(The call is cancelled because it applies to an update that is hidden (no longer applicable to this computer))" },
+    { 0x8024005BL, L"WU_E_CALL_CANCELLED_BY_INVALID\r\n(The call is cancelled because it applies to an update that is invalid (no longer applicable to this computer))" },
+    { 0x8024005CL, L"WU_E_INVALID_VOLUMEID\r\n(The specified volume id is invalid)" },
+    { 0x8024005DL, L"WU_E_UNRECOGNIZED_VOLUMEID\r\n(The specified volume id is unrecognized by the system)" },
+    { 0x8024005EL, L"WU_E_EXTENDEDERROR_NOTSET\r\n(The installation extended error code is not specified)" },
+    { 0x8024005FL, L"WU_E_EXTENDEDERROR_FAILED\r\n(The installation extended error code is set to general fail)" },
+    { 0x80240060L, L"WU_E_IDLESHUTDOWN_OPCOUNT_SERVICEREGISTRATION\r\n(A service registration call contributed to a non-zero operation count at idle timer shutdown)" },
+    { 0x80240061L, L"WU_E_FILETRUST_SHA2SIGNATURE_MISSING\r\n(Signature validation of the file fails to find valid SHA2+ signature on MS signed payload)" },
+    { 0x80240062L, L"WU_E_UPDATE_NOT_APPROVED\r\n(The update is not in the servicing approval list)" },
+    { 0x80240063L, L"WU_E_CALL_CANCELLED_BY_INTERACTIVE_SEARCH\r\n(The search call was cancelled by another interactive search against the same service)" },
+    { 0x80240064L, L"WU_E_INSTALL_JOB_RESUME_NOT_ALLOWED\r\n(Resume of install job not allowed due to another installation in progress)" },
+    { 0x80240065L, L"WU_E_INSTALL_JOB_NOT_SUSPENDED\r\n(Resume of install job not allowed because job is not suspended)" },
+    { 0x80240066L, L"WU_E_INSTALL_USERCONTEXT_ACCESSDENIED\r\n(User context passed to installation from caller with insufficient privileges)" },
+    { 0x80240067L, L"WU_E_STANDBY_ACTIVITY_NOT_ALLOWED\r\n(Operation is not allowed because the device is in DC (Direct Current) and DS (Disconnected Standby))" },
+    { 0x80240068L, L"WU_E_COULD_NOT_EVALUATE_PROPERTY\r\n(The property could not be evaluated)" },
+    { 0x80240436L, L"WU_E_PT_CATALOG_SYNC_REQUIRED\r\n(The server does not support category-specific search; Full catalog search has to be issued instead)" },
+    { 0x80240437L, L"WU_E_PT_SECURITY_VERIFICATION_FAILURE\r\n(There was a problem authorizing with the service)" },
+    { 0x80240438L, L"WU_E_PT_ENDPOINT_UNREACHABLE\r\n(There is no route or network connectivity to the endpoint)" },
+    { 0x80240439L, L"WU_E_PT_INVALID_FORMAT\r\n(The data received does not meet the data contract expectations)" },
+    { 0x8024043AL, L"WU_E_PT_INVALID_URL\r\n(The url is invalid)" },
+    { 0x8024043BL, L"WU_E_PT_NWS_NOT_LOADED\r\n(Unable to load NWS runtime)" },
+    { 0x8024043CL, L"WU_E_PT_PROXY_AUTH_SCHEME_NOT_SUPPORTED\r\n(The proxy auth scheme is not supported)" },
+    { 0x8024043DL, L"WU_E_SERVICEPROP_NOTAVAIL\r\n(The requested service property is not available)" },
+    { 0x8024043EL, L"WU_E_PT_ENDPOINT_REFRESH_REQUIRED\r\n(The endpoint provider plugin requires online refresh)" },
+    { 0x8024043FL, L"WU_E_PT_ENDPOINTURL_NOTAVAIL\r\n(A URL for the requested service endpoint is not available)" },
+    { 0x80240440L, L"WU_E_PT_ENDPOINT_DISCONNECTED\r\n(The connection to the service endpoint died)" },
+    { 0x80240441L, L"WU_E_PT_INVALID_OPERATION\r\n(The operation is invalid because protocol talker is in an inappropriate state)" },
+    { 0x80240442L, L"WU_E_PT_OBJECT_FAULTED\r\n(The object is in a faulted state due to a previous error)" },
+    { 0x80240443L, L"WU_E_PT_NUMERIC_OVERFLOW\r\n(The operation would lead to numeric overflow)" },
+    { 0x80240444L, L"WU_E_PT_OPERATION_ABORTED\r\n(The operation was aborted)" },
+    { 0x80240445L, L"WU_E_PT_OPERATION_ABANDONED\r\n(The operation was abandoned)" },
+    { 0x80240446L, L"WU_E_PT_QUOTA_EXCEEDED\r\n(A quota was exceeded)" },
+    { 0x80240447L, L"WU_E_PT_NO_TRANSLATION_AVAILABLE\r\n(The information was not available in the specified language)" },
+    { 0x80240448L, L"WU_E_PT_ADDRESS_IN_USE\r\n(The address is already being used)" },
+    { 0x80240449L, L"WU_E_PT_ADDRESS_NOT_AVAILABLE\r\n(The address is not valid for this context)" },
+    { 0x8024044AL, L"WU_E_PT_OTHER\r\n(Unrecognized error occurred in the Windows Web Services framework)" },
+    { 0x8024044BL, L"WU_E_PT_SECURITY_SYSTEM_FAILURE\r\n(A security operation failed in the Windows Web Services framework)" },
+    { 0x80240FFFL, L"WU_E_UNEXPECTED\r\n(An operation failed due to reasons not covered by another error code)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Windows Installer minor errors
+    //
+    // The following errors are used to indicate that part of a search failed for
+    // MSI problems. Another part of the search may successfully return updates.
+    // All MSI minor codes should share the same error code range so that the caller
+    // tell that they are related to Windows Installer.
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80241001L, L"WU_E_MSI_WRONG_VERSION\r\n(Search may have missed some updates because the Windows Installer is less than version 3.1)" },
+    { 0x80241002L, L"WU_E_MSI_NOT_CONFIGURED\r\n(Search may have missed some updates because the Windows Installer is not configured)" },
+    { 0x80241003L, L"WU_E_MSP_DISABLED\r\n(Search may have missed some updates because policy has disabled Windows Installer patching)" },
+    { 0x80241004L, L"WU_E_MSI_WRONG_APP_CONTEXT\r\n(An update could not be applied because the application is installed per-user)" },
+    { 0x80241005L, L"WU_E_MSI_NOT_PRESENT\r\n(Search may have missed some updates because the Windows Installer is less than version 3.1)" },
+    { 0x80241FFFL, L"WU_E_MSP_UNEXPECTED\r\n(Search may have missed some updates because there was a failure of the Windows Installer)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // update handler errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80242000L, L"WU_E_UH_REMOTEUNAVAILABLE\r\n(A request for a remote update handler could not be completed because no remote process is available)" },
+    { 0x80242001L, L"WU_E_UH_LOCALONLY\r\n(A request for a remote update handler could not be completed because the handler is local only)" },
+    { 0x80242002L, L"WU_E_UH_UNKNOWNHANDLER\r\n(A request for an update handler could not be completed because the handler could not be recognized)" },
+    { 0x80242003L, L"WU_E_UH_REMOTEALREADYACTIVE\r\n(A remote update handler could not be created because one already exists)" },
+    { 0x80242004L, L"WU_E_UH_DOESNOTSUPPORTACTION\r\n(A request for the handler to install (uninstall) an update could not be completed because the update does not support install (uninstall))" },
+    { 0x80242005L, L"WU_E_UH_WRONGHANDLER\r\n(An operation did not complete because the wrong handler was specified)" },
+    { 0x80242006L, L"WU_E_UH_INVALIDMETADATA\r\n(A handler operation could not be completed because the update contains invalid metadata)" },
+    { 0x80242007L, L"WU_E_UH_INSTALLERHUNG\r\n(An operation could not be completed because the installer exceeded the time limit)" },
+    { 0x80242008L, L"WU_E_UH_OPERATIONCANCELLED\r\n(An operation being done by the update handler was cancelled)" },
+    { 0x80242009L, L"WU_E_UH_BADHANDLERXML\r\n(An operation could not be completed because the handler-specific metadata is invalid)" },
+    { 0x8024200AL, L"WU_E_UH_CANREQUIREINPUT\r\n(A request to the handler to install an update could not be completed because the update requires user input)" },
+    { 0x8024200BL, L"WU_E_UH_INSTALLERFAILURE\r\n(The installer failed to install (uninstall) one or more updates)" },
+    { 0x8024200CL, L"WU_E_UH_FALLBACKTOSELFCONTAINED\r\n(The update handler should download self-contained content rather than delta-compressed content for the update)" },
+    { 0x8024200DL, L"WU_E_UH_NEEDANOTHERDOWNLOAD\r\n(The update handler did not install the update because it needs to be downloaded again)" },
+    { 0x8024200EL, L"WU_E_UH_NOTIFYFAILURE\r\n(The update handler failed to send notification of the status of the install (uninstall) operation)" },
+    { 0x8024200FL, L"WU_E_UH_INCONSISTENT_FILE_NAMES\r\n(The file names contained in the update metadata and in the update package are inconsistent)" },
+    { 0x80242010L, L"WU_E_UH_FALLBACKERROR\r\n(The update handler failed to fall back to the self-contained content)" },
+    { 0x80242011L, L"WU_E_UH_TOOMANYDOWNLOADREQUESTS\r\n(The update handler has exceeded the maximum number of download requests)" },
+    { 0x80242012L, L"WU_E_UH_UNEXPECTEDCBSRESPONSE\r\n(The update handler has received an unexpected response from CBS)" },
+    { 0x80242013L, L"WU_E_UH_BADCBSPACKAGEID\r\n(The update metadata contains an invalid CBS package identifier)" },
+    { 0x80242014L, L"WU_E_UH_POSTREBOOTSTILLPENDING\r\n(The post-reboot operation for the update is still in progress)" },
+    { 0x80242015L, L"WU_E_UH_POSTREBOOTRESULTUNKNOWN\r\n(The result of the post-reboot operation for the update could not be determined)" },
+    { 0x80242016L, L"WU_E_UH_POSTREBOOTUNEXPECTEDSTATE\r\n(The state of the update after its post-reboot operation has completed is unexpected)" },
+    { 0x80242017L, L"WU_E_UH_NEW_SERVICING_STACK_REQUIRED\r\n(The OS servicing stack must be updated before this update is downloaded or installed)" },
+    { 0x80242018L, L"WU_E_UH_CALLED_BACK_FAILURE\r\n(A callback installer called back with an error)" },
+    { 0x80242019L, L"WU_E_UH_CUSTOMINSTALLER_INVALID_SIGNATURE\r\n(The custom installer signature did not match the signature required by the update)" },
+    { 0x8024201AL, L"WU_E_UH_UNSUPPORTED_INSTALLCONTEXT\r\n(The installer does not support the installation configuration)" },
+    { 0x8024201BL, L"WU_E_UH_INVALID_TARGETSESSION\r\n(The targeted session for install is invalid)" },
+    { 0x8024201CL, L"WU_E_UH_DECRYPTFAILURE\r\n(The handler failed to decrypt the update files)" },
+    { 0x8024201DL, L"WU_E_UH_HANDLER_DISABLEDUNTILREBOOT\r\n(The update handler is disabled until the system reboots)" },
+    { 0x8024201EL, L"WU_E_UH_APPX_NOT_PRESENT\r\n(The AppX infrastructure is not present on the system)" },
+    { 0x8024201FL, L"WU_E_UH_NOTREADYTOCOMMIT\r\n(The update cannot be committed because it has not been previously installed or staged)" },
+    { 0x80242020L, L"WU_E_UH_APPX_INVALID_PACKAGE_VOLUME\r\n(The specified volume is not a valid AppX package volume)" },
+    { 0x80242021L, L"WU_E_UH_APPX_DEFAULT_PACKAGE_VOLUME_UNAVAILABLE\r\n(The configured default storage volume is unavailable)" },
+    { 0x80242022L, L"WU_E_UH_APPX_INSTALLED_PACKAGE_VOLUME_UNAVAILABLE\r\n(The volume on which the application is installed is unavailable)" },
+    { 0x80242023L, L"WU_E_UH_APPX_PACKAGE_FAMILY_NOT_FOUND\r\n(The specified package family is not present on the system)" },
+    { 0x80242024L, L"WU_E_UH_APPX_SYSTEM_VOLUME_NOT_FOUND\r\n(Unable to find a package volume marked as system)" },
+    { 0x80242025L, L"WU_E_UH_UA_SESSION_INFO_VERSION_NOT_SUPPORTED\r\n(UA does not support the version of OptionalSessionInfo)" },
+    { 0x80242026L, L"WU_E_UH_RESERVICING_REQUIRED_BASELINE\r\n(This operation cannot be completed. You must install the baseline update(s) before you can install this update)" },
+    { 0x80242FFFL, L"WU_E_UH_UNEXPECTED\r\n(An update handler error not covered by another WU_E_UH_* code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // UI errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80243001L, L"WU_E_INSTALLATION_RESULTS_UNKNOWN_VERSION\r\n(The results of download and installation could not be read from the registry due to an unrecognized data format version)" },
+    { 0x80243002L, L"WU_E_INSTALLATION_RESULTS_INVALID_DATA\r\n(The results of download and installation could not be read from the registry due to an invalid data format)" },
+    { 0x80243003L, L"WU_E_INSTALLATION_RESULTS_NOT_FOUND\r\n(The results of download and installation are not available; the operation may have failed to start)" },
+    { 0x80243004L, L"WU_E_TRAYICON_FAILURE\r\n(A failure occurred when trying to create an icon in the taskbar notification area)" },
+    { 0x80243FFDL, L"WU_E_NON_UI_MODE\r\n(Unable to show UI when in non-UI mode; WU client UI modules may not be installed)" },
+    { 0x80243FFEL, L"WU_E_WUCLTUI_UNSUPPORTED_VERSION\r\n(Unsupported version of WU client UI exported functions)" },
+    { 0x80243FFFL, L"WU_E_AUCLIENT_UNEXPECTED\r\n(There was a user interface error not covered by another WU_E_AUCLIENT_* error code)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Protocol Talker errors
+    //
+    // The following map to SOAPCLIENT_ERRORs from atlsoap.h. These errors
+    // are obtained from calling GetClientError() on the CClientWebService
+    // object.
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80244000L, L"WU_E_PT_SOAPCLIENT_BASE\r\n(WU_E_PT_SOAPCLIENT_* error codes map to the SOAPCLIENT_ERROR enum of the ATL Server Library)" },
+    { 0x80244001L, L"WU_E_PT_SOAPCLIENT_INITIALIZE\r\n(Same as SOAPCLIENT_INITIALIZE_ERROR - initialization of the SOAP client failed, possibly because of an MSXML installation failure)" },
+    { 0x80244002L, L"WU_E_PT_SOAPCLIENT_OUTOFMEMORY\r\n(Same as SOAPCLIENT_OUTOFMEMORY - SOAP client failed because it ran out of memory)" },
+    { 0x80244003L, L"WU_E_PT_SOAPCLIENT_GENERATE\r\n(Same as SOAPCLIENT_GENERATE_ERROR - SOAP client failed to generate the request)" },
+    { 0x80244004L, L"WU_E_PT_SOAPCLIENT_CONNECT\r\n(Same as SOAPCLIENT_CONNECT_ERROR - SOAP client failed to connect to the server)" },
+    { 0x80244005L, L"WU_E_PT_SOAPCLIENT_SEND\r\n(Same as SOAPCLIENT_SEND_ERROR - SOAP client failed to send a message for reasons of WU_E_WINHTTP_* error codes)" },
+    { 0x80244006L, L"WU_E_PT_SOAPCLIENT_SERVER\r\n(Same as SOAPCLIENT_SERVER_ERROR - SOAP client failed because there was a server error)" },
+    { 0x80244007L, L"WU_E_PT_SOAPCLIENT_SOAPFAULT\r\n(Same as SOAPCLIENT_SOAPFAULT - SOAP client failed because there was a SOAP fault for reasons of WU_E_PT_SOAP_* error codes)" },
+    { 0x80244008L, L"WU_E_PT_SOAPCLIENT_PARSEFAULT\r\n(Same as SOAPCLIENT_PARSEFAULT_ERROR - SOAP client failed to parse a SOAP fault)" },
+    { 0x80244009L, L"WU_E_PT_SOAPCLIENT_READ\r\n(Same as SOAPCLIENT_READ_ERROR - SOAP client failed while reading the response from the server)" },
+    { 0x8024400AL, L"WU_E_PT_SOAPCLIENT_PARSE\r\n(Same as SOAPCLIENT_PARSE_ERROR - SOAP client failed to parse the response from the server)" },
+
+    // The following map to SOAP_ERROR_CODEs from atlsoap.h. These errors
+    // are obtained from the m_fault.m_soapErrCode member on the
+    // CClientWebService object when GetClientError() returned
+    // SOAPCLIENT_SOAPFAULT.
+    { 0x8024400BL, L"WU_E_PT_SOAP_VERSION\r\n(Same as SOAP_E_VERSION_MISMATCH - SOAP client found an unrecognizable namespace for the SOAP envelope)" },
+    { 0x8024400CL, L"WU_E_PT_SOAP_MUST_UNDERSTAND\r\n(Same as SOAP_E_MUST_UNDERSTAND - SOAP client was unable to understand a header)" },
+    { 0x8024400DL, L"WU_E_PT_SOAP_CLIENT\r\n(Same as SOAP_E_CLIENT - SOAP client found the message was malformed; fix before resending)" },
+    { 0x8024400EL, L"WU_E_PT_SOAP_SERVER\r\n(Same as SOAP_E_SERVER - The SOAP message could not be processed due to a server error; resend later)" },
+    { 0x8024400FL, L"WU_E_PT_WMI_ERROR\r\n(There was an unspecified Windows Management Instrumentation (WMI) error)" },
+    { 0x80244010L, L"WU_E_PT_EXCEEDED_MAX_SERVER_TRIPS\r\n(The number of round trips to the server exceeded the maximum limit)" },
+    { 0x80244011L, L"WU_E_PT_SUS_SERVER_NOT_SET\r\n(WUServer policy value is missing in the registry)" },
+    { 0x80244012L, L"WU_E_PT_DOUBLE_INITIALIZATION\r\n(Initialization failed because the object was already initialized)" },
+    { 0x80244013L, L"WU_E_PT_INVALID_COMPUTER_NAME\r\n(The computer name could not be determined)" },
+    { 0x80244015L, L"WU_E_PT_REFRESH_CACHE_REQUIRED\r\n(The reply from the server indicates that the server was changed or the cookie was invalid; refresh the state of the internal cache and retry)" },
+    { 0x80244016L, L"WU_E_PT_HTTP_STATUS_BAD_REQUEST\r\n(Same as HTTP status 400 - the server could not process the request due to invalid syntax)" },
+    { 0x80244017L, L"WU_E_PT_HTTP_STATUS_DENIED\r\n(Same as HTTP status 401 - the requested resource requires user authentication)" },
+    { 0x80244018L, L"WU_E_PT_HTTP_STATUS_FORBIDDEN\r\n(Same as HTTP status 403 - server understood the request, but declined to fulfill it)" },
+    { 0x80244019L, L"WU_E_PT_HTTP_STATUS_NOT_FOUND\r\n(Same as HTTP status 404 - the server cannot find the requested URI (Uniform Resource Identifier))" },
+    { 0x8024401AL, L"WU_E_PT_HTTP_STATUS_BAD_METHOD\r\n(Same as HTTP status 405 - the HTTP method is not allowed)" },
+    { 0x8024401BL, L"WU_E_PT_HTTP_STATUS_PROXY_AUTH_REQ\r\n(Same as HTTP status 407 - proxy authentication is required)" },
+    { 0x8024401CL, L"WU_E_PT_HTTP_STATUS_REQUEST_TIMEOUT\r\n(Same as HTTP status 408 - the server timed out waiting for the request)" },
+    { 0x8024401DL, L"WU_E_PT_HTTP_STATUS_CONFLICT\r\n(Same as HTTP status 409 - the request was not completed due to a conflict with the current state of the resource)" },
+    { 0x8024401EL, L"WU_E_PT_HTTP_STATUS_GONE\r\n(Same as HTTP status 410 - requested resource is no longer available at the server)" },
+    { 0x8024401FL, L"WU_E_PT_HTTP_STATUS_SERVER_ERROR\r\n(Same as HTTP status 500 - an error internal to the server prevented fulfilling the request)" },
+    { 0x80244020L, L"WU_E_PT_HTTP_STATUS_NOT_SUPPORTED\r\n(Same as HTTP status 500 - server does not support the functionality required to fulfill the request)" },
+    { 0x80244021L, L"WU_E_PT_HTTP_STATUS_BAD_GATEWAY\r\n(Same as HTTP status 502 - the server, while acting as a gateway or proxy, received an invalid response from the upstream server it accessed in attempting to fulfill the request)" },
+    { 0x80244022L, L"WU_E_PT_HTTP_STATUS_SERVICE_UNAVAIL\r\n(Same as HTTP status 503 - the service is temporarily overloaded)" },
+    { 0x80244023L, L"WU_E_PT_HTTP_STATUS_GATEWAY_TIMEOUT\r\n(Same as HTTP status 503 - the request was timed out waiting for a gateway)" },
+    { 0x80244024L, L"WU_E_PT_HTTP_STATUS_VERSION_NOT_SUP\r\n(Same as HTTP status 505 - the server does not support the HTTP protocol version used for the request)" },
+    { 0x80244025L, L"WU_E_PT_FILE_LOCATIONS_CHANGED\r\n(Operation failed due to a changed file location; refresh internal state and resend)" },
+    { 0x80244026L, L"WU_E_PT_REGISTRATION_NOT_SUPPORTED\r\n(Operation failed because Windows Update Agent does not support registration with a non-WSUS server)" },
+    { 0x80244027L, L"WU_E_PT_NO_AUTH_PLUGINS_REQUESTED\r\n(The server returned an empty authentication information list)" },
+    { 0x80244028L, L"WU_E_PT_NO_AUTH_COOKIES_CREATED\r\n(Windows Update Agent was unable to create any valid authentication cookies)" },
+    { 0x80244029L, L"WU_E_PT_INVALID_CONFIG_PROP\r\n(A configuration property value was wrong)" },
+    { 0x8024402AL, L"WU_E_PT_CONFIG_PROP_MISSING\r\n(A configuration property value was missing)" },
+    { 0x8024402BL, L"WU_E_PT_HTTP_STATUS_NOT_MAPPED\r\n(The HTTP request could not be completed and the reason did not correspond to any of the WU_E_PT_HTTP_* error codes)" },
+    { 0x8024402CL, L"WU_E_PT_WINHTTP_NAME_NOT_RESOLVED\r\n(Same as ERROR_WINHTTP_NAME_NOT_RESOLVED - the proxy server or target server name cannot be resolved)" },
+    { 0x8024402DL, L"WU_E_PT_LOAD_SHEDDING\r\n(The server is shedding load)" },
+    { 0x8024402EL, L"WU_E_PT_CLIENT_ENFORCED_LOAD_SHEDDING\r\n(Windows Update Agent is enforcing honoring the service load shedding interval)" },
+    { 0x8024402FL, L"WU_E_PT_ECP_SUCCEEDED_WITH_ERRORS\r\n(External cab file processing completed with some errors)" },
+    { 0x80244030L, L"WU_E_PT_ECP_INIT_FAILED\r\n(The external cab processor initialization did not complete)" },
+    { 0x80244031L, L"WU_E_PT_ECP_INVALID_FILE_FORMAT\r\n(The format of a metadata file was invalid)" },
+    { 0x80244032L, L"WU_E_PT_ECP_INVALID_METADATA\r\n(External cab processor found invalid metadata)" },
+    { 0x80244033L, L"WU_E_PT_ECP_FAILURE_TO_EXTRACT_DIGEST\r\n(The file digest could not be extracted from an external cab file)" },
+    { 0x80244034L, L"WU_E_PT_ECP_FAILURE_TO_DECOMPRESS_CAB_FILE\r\n(An external cab file could not be decompressed)" },
+    { 0x80244035L, L"WU_E_PT_ECP_FILE_LOCATION_ERROR\r\n(External cab processor was unable to get file locations)" },
+    { 0x80244100L, L"WU_E_PT_DATA_BOUNDARY_RESTRICTED\r\n(The client is data boundary restricted and needs to talk to a restricted endpoint)" },
+    { 0x80244101L, L"WU_E_PT_GENERAL_AAD_CLIENT_ERROR\r\n(The client hit an error in retrieving AAD device ticket)" },
+    { 0x80244FFFL, L"WU_E_PT_UNEXPECTED\r\n(A communication error not covered by another WU_E_PT_* error code)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Redirector errors
+    //
+    // The following errors are generated by the components that download and
+    // parse the wuredir.cab
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80245001L, L"WU_E_REDIRECTOR_LOAD_XML\r\n(The redirector XML document could not be loaded into the DOM class)" },
+    { 0x80245002L, L"WU_E_REDIRECTOR_S_FALSE\r\n(The redirector XML document is missing some required information)" },
+    { 0x80245003L, L"WU_E_REDIRECTOR_ID_SMALLER\r\n(The redirectorId in the downloaded redirector cab is less than in the cached cab)" },
+    { 0x80245004L, L"WU_E_REDIRECTOR_UNKNOWN_SERVICE\r\n(The service ID is not supported in the service environment)" },
+    { 0x80245005L, L"WU_E_REDIRECTOR_UNSUPPORTED_CONTENTTYPE\r\n(The response from the redirector server had an unsupported content type)" },
+    { 0x80245006L, L"WU_E_REDIRECTOR_INVALID_RESPONSE\r\n(The response from the redirector server had an error status or was invalid)" },
+    { 0x80245008L, L"WU_E_REDIRECTOR_ATTRPROVIDER_EXCEEDED_MAX_NAMEVALUE\r\n(The maximum number of name value pairs was exceeded by the attribute provider)" },
+    { 0x80245009L, L"WU_E_REDIRECTOR_ATTRPROVIDER_INVALID_NAME\r\n(The name received from the attribute provider was invalid)" },
+    { 0x8024500AL, L"WU_E_REDIRECTOR_ATTRPROVIDER_INVALID_VALUE\r\n(The value received from the attribute provider was invalid)" },
+    { 0x8024500BL, L"WU_E_REDIRECTOR_SLS_GENERIC_ERROR\r\n(There was an error in connecting to or parsing the response from the Service Locator Service redirector server)" },
+    { 0x8024500CL, L"WU_E_REDIRECTOR_CONNECT_POLICY\r\n(Connections to the redirector server are disallowed by managed policy)" },
+    { 0x8024500DL, L"WU_E_REDIRECTOR_ONLINE_DISALLOWED\r\n(The redirector would go online but is disallowed by caller configuration)" },
+    { 0x8024502DL, L"WU_E_PT_SAME_REDIR_ID\r\n(Windows Update Agent failed to download a redirector cabinet file with a new redirectorId value from the server during the recovery)" },
+    { 0x8024502EL, L"WU_E_PT_NO_MANAGED_RECOVER\r\n(A redirector recovery action did not complete because the server is managed)" },
+    { 0x802450FFL, L"WU_E_REDIRECTOR_UNEXPECTED\r\n(The redirector failed for reasons not covered by another WU_E_REDIRECTOR_* error code)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SIH errors
+    //
+    // The following errors are generated by the components that are involved with
+    // service-initiated healing.
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80245101L, L"WU_E_SIH_VERIFY_DOWNLOAD_ENGINE\r\n(Verification of the servicing engine package failed)" },
+    { 0x80245102L, L"WU_E_SIH_VERIFY_DOWNLOAD_PAYLOAD\r\n(Verification of a servicing package failed)" },
+    { 0x80245103L, L"WU_E_SIH_VERIFY_STAGE_ENGINE\r\n(Verification of the staged engine failed)" },
+    { 0x80245104L, L"WU_E_SIH_VERIFY_STAGE_PAYLOAD\r\n(Verification of a staged payload failed)" },
+    { 0x80245105L, L"WU_E_SIH_ACTION_NOT_FOUND\r\n(An internal error occurred where the servicing action was not found)" },
+    { 0x80245106L, L"WU_E_SIH_SLS_PARSE\r\n(There was a parse error in the service environment response)" },
+    { 0x80245107L, L"WU_E_SIH_INVALIDHASH\r\n(A downloaded file failed an integrity check)" },
+    { 0x80245108L, L"WU_E_SIH_NO_ENGINE\r\n(No engine was provided by the server-initiated healing server response)" },
+    { 0x80245109L, L"WU_E_SIH_POST_REBOOT_INSTALL_FAILED\r\n(Post-reboot install failed)" },
+    { 0x8024510AL, L"WU_E_SIH_POST_REBOOT_NO_CACHED_SLS_RESPONSE\r\n(There were pending reboot actions, but cached SLS response was not found post-reboot)" },
+    { 0x8024510BL, L"WU_E_SIH_PARSE\r\n(Parsing command line arguments failed)" },
+    { 0x8024510CL, L"WU_E_SIH_SECURITY\r\n(Security check failed)" },
+    { 0x8024510DL, L"WU_E_SIH_PPL\r\n(PPL check failed)" },
+    { 0x8024510EL, L"WU_E_SIH_POLICY\r\n(Execution was disabled by policy)" },
+    { 0x8024510FL, L"WU_E_SIH_STDEXCEPTION\r\n(A standard exception was caught)" },
+    { 0x80245110L, L"WU_E_SIH_NONSTDEXCEPTION\r\n(A non-standard exception was caught)" },
+    { 0x80245111L, L"WU_E_SIH_ENGINE_EXCEPTION\r\n(The server-initiated healing engine encountered an exception not covered by another WU_E_SIH_* error code)" },
+    { 0x80245112L, L"WU_E_SIH_BLOCKED_FOR_PLATFORM\r\n(You are running SIH Client with cmd not supported on your platform)" },
+    { 0x80245113L, L"WU_E_SIH_ANOTHER_INSTANCE_RUNNING\r\n(Another SIH Client is already running)" },
+    { 0x80245114L, L"WU_E_SIH_DNSRESILIENCY_OFF\r\n(Disable DNS resiliency feature per service configuration)" },
+    { 0x802451FFL, L"WU_E_SIH_UNEXPECTED\r\n(There was a failure for reasons not covered by another WU_E_SIH_* error code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // download manager errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80246001L, L"WU_E_DM_URLNOTAVAILABLE\r\n(A download manager operation could not be completed because the requested file does not have a URL)" },
+    { 0x80246002L, L"WU_E_DM_INCORRECTFILEHASH\r\n(A download manager operation could not be completed because the file digest was not recognized)" },
+    { 0x80246003L, L"WU_E_DM_UNKNOWNALGORITHM\r\n(A download manager operation could not be completed because the file metadata requested an unrecognized hash algorithm)" },
+    { 0x80246004L, L"WU_E_DM_NEEDDOWNLOADREQUEST\r\n(An operation could not be completed because a download request is required from the download handler)" },
+    { 0x80246005L, L"WU_E_DM_NONETWORK\r\n(A download manager operation could not be completed because the network connection was unavailable)" },
+    { 0x80246006L, L"WU_E_DM_WRONGBITSVERSION\r\n(A download manager operation could not be completed because the version of Background Intelligent Transfer Service (BITS) is incompatible)" },
+    { 0x80246007L, L"WU_E_DM_NOTDOWNLOADED\r\n(The update has not been downloaded)" },
+    { 0x80246008L, L"WU_E_DM_FAILTOCONNECTTOBITS\r\n(A download manager operation failed because the download manager was unable to connect the Background Intelligent Transfer Service (BITS))" },
+    { 0x80246009L, L"WU_E_DM_BITSTRANSFERERROR\r\n(A download manager operation failed because there was an unspecified Background Intelligent Transfer Service (BITS) transfer error)" },
+    { 0x8024600AL, L"WU_E_DM_DOWNLOADLOCATIONCHANGED\r\n(A download must be restarted because the location of the source of the download has changed)" },
+    { 0x8024600BL, L"WU_E_DM_CONTENTCHANGED\r\n(A download must be restarted because the update content changed in a new revision)" },
+    { 0x8024600CL, L"WU_E_DM_DOWNLOADLIMITEDBYUPDATESIZE\r\n(A download failed because the current network limits downloads by update size for the update service)" },
+    { 0x8024600EL, L"WU_E_DM_UNAUTHORIZED\r\n(The download failed because the client was denied authorization to download the content)" },
+    { 0x8024600FL, L"WU_E_DM_BG_ERROR_TOKEN_REQUIRED\r\n(The download failed because the user token associated with the BITS job no longer exists)" },
+    { 0x80246010L, L"WU_E_DM_DOWNLOADSANDBOXNOTFOUND\r\n(The sandbox directory for the downloaded update was not found)" },
+    { 0x80246011L, L"WU_E_DM_DOWNLOADFILEPATHUNKNOWN\r\n(The downloaded update has an unknown file path)" },
+    { 0x80246012L, L"WU_E_DM_DOWNLOADFILEMISSING\r\n(One or more of the files for the downloaded update is missing)" },
+    { 0x80246013L, L"WU_E_DM_UPDATEREMOVED\r\n(An attempt was made to access a downloaded update that has already been removed)" },
+    { 0x80246014L, L"WU_E_DM_READRANGEFAILED\r\n(Windows Update couldn't find a needed portion of a downloaded update's file)" },
+    { 0x80246016L, L"WU_E_DM_UNAUTHORIZED_NO_USER\r\n(The download failed because the client was denied authorization to download the content due to no user logged on)" },
+    { 0x80246017L, L"WU_E_DM_UNAUTHORIZED_LOCAL_USER\r\n(The download failed because the local user was denied authorization to download the content)" },
+    { 0x80246018L, L"WU_E_DM_UNAUTHORIZED_DOMAIN_USER\r\n(The download failed because the domain user was denied authorization to download the content)" },
+    { 0x80246019L, L"WU_E_DM_UNAUTHORIZED_MSA_USER\r\n(The download failed because the MSA account associated with the user was denied authorization to download the content)" },
+    { 0x8024601AL, L"WU_E_DM_FALLINGBACKTOBITS\r\n(The download will be continued by falling back to BITS to download the content)" },
+    { 0x8024601BL, L"WU_E_DM_DOWNLOAD_VOLUME_CONFLICT\r\n(Another caller has requested download to a different volume)" },
+    { 0x8024601CL, L"WU_E_DM_SANDBOX_HASH_MISMATCH\r\n(The hash of the update's sandbox does not match the expected value)" },
+    { 0x8024601DL, L"WU_E_DM_HARDRESERVEID_CONFLICT\r\n(The hard reserve id specified conflicts with an id from another caller)" },
+    { 0x8024601EL, L"WU_E_DM_DOSVC_REQUIRED\r\n(The update has to be downloaded via DO)" },
+    { 0x8024601FL, L"WU_E_DM_DOWNLOADTYPE_CONFLICT\r\n(Windows Update only supports one download type per update at one time. The download failure is by design here since the same update with different download type is operating. Please try again later)" },
+    { 0x80246FFFL, L"WU_E_DM_UNEXPECTED\r\n(There was a download manager error not covered by another WU_E_DM_* error code)" },
+    { 0x80247001L, L"WU_E_OL_INVALID_SCANFILE\r\n(An operation could not be completed because the scan package was invalid)" },
+    { 0x80247002L, L"WU_E_OL_NEWCLIENT_REQUIRED\r\n(An operation could not be completed because the scan package requires a greater version of the Windows Update Agent)" },
+    { 0x80247003L, L"WU_E_INVALID_EVENT_PAYLOAD\r\n(An invalid event payload was specified)" },
+    { 0x80247004L, L"WU_E_INVALID_EVENT_PAYLOADSIZE\r\n(The size of the event payload submitted is invalid)" },
+    { 0x80247005L, L"WU_E_SERVICE_NOT_REGISTERED\r\n(The service is not registered)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // WU Metadata Integrity related errors - 0x71FE
+    ///////////////////////////////////////////////////////////////////////////////
+    ///////
+    // Metadata General errors 0x7100 - 0x711F
+    ///////
+    { 0x80247100L, L"WU_E_METADATA_NOOP\r\n(No operation was required by update metadata verification)" },
+    { 0x80247101L, L"WU_E_METADATA_CONFIG_INVALID_BINARY_ENCODING\r\n(The binary encoding of metadata config data was invalid)" },
+    { 0x80247102L, L"WU_E_METADATA_FETCH_CONFIG\r\n(Unable to fetch required configuration for metadata signature verification)" },
+    { 0x80247104L, L"WU_E_METADATA_INVALID_PARAMETER\r\n(A metadata verification operation failed due to an invalid parameter)" },
+    { 0x80247105L, L"WU_E_METADATA_UNEXPECTED\r\n(A metadata verification operation failed due to reasons not covered by another error code)" },
+    { 0x80247106L, L"WU_E_METADATA_NO_VERIFICATION_DATA\r\n(None of the update metadata had verification data, which may be disabled on the update server)" },
+    { 0x80247107L, L"WU_E_METADATA_BAD_FRAGMENTSIGNING_CONFIG\r\n(The fragment signing configuration used for verifying update metadata signatures was bad)" },
+    { 0x80247108L, L"WU_E_METADATA_FAILURE_PROCESSING_FRAGMENTSIGNING_CONFIG\r\n(There was an unexpected operational failure while parsing fragment signing configuration)" },
+
+    ///////
+    // Metadata XML errors 0x7120 - 0x713F
+    ///////
+    { 0x80247120L, L"WU_E_METADATA_XML_MISSING\r\n(Required xml data was missing from configuration)" },
+    { 0x80247121L, L"WU_E_METADATA_XML_FRAGMENTSIGNING_MISSING\r\n(Required fragmentsigning data was missing from xml configuration)" },
+    { 0x80247122L, L"WU_E_METADATA_XML_MODE_MISSING\r\n(Required mode data was missing from xml configuration)" },
+    { 0x80247123L, L"WU_E_METADATA_XML_MODE_INVALID\r\n(An invalid metadata enforcement mode was detected)" },
+    { 0x80247124L, L"WU_E_METADATA_XML_VALIDITY_INVALID\r\n(An invalid timestamp validity window configuration was detected)" },
+    { 0x80247125L, L"WU_E_METADATA_XML_LEAFCERT_MISSING\r\n(Required leaf certificate data was missing from xml configuration)" },
+    { 0x80247126L, L"WU_E_METADATA_XML_INTERMEDIATECERT_MISSING\r\n(Required intermediate certificate data was missing from xml configuration)" },
+    { 0x80247127L, L"WU_E_METADATA_XML_LEAFCERT_ID_MISSING\r\n(Required leaf certificate id attribute was missing from xml configuration)" },
+    { 0x80247128L, L"WU_E_METADATA_XML_BASE64CERDATA_MISSING\r\n(Required certificate base64CerData attribute was missing from xml configuration)" },
+
+    ///////
+    // Metadata Signature/Hash-related errors 0x7140 - 0x714F
+    ///////
+    { 0x80247140L, L"WU_E_METADATA_BAD_SIGNATURE\r\n(The metadata for an update was found to have a bad or invalid digital signature)" },
+    { 0x80247141L, L"WU_E_METADATA_UNSUPPORTED_HASH_ALG\r\n(An unsupported hash algorithm for metadata verification was specified)" },
+    { 0x80247142L, L"WU_E_METADATA_SIGNATURE_VERIFY_FAILED\r\n(An error occurred during an update's metadata signature verification)" },
+
+    ///////
+    // Metadata Certificate Chain trust related errors 0x7150 - 0x715F
+    ///////
+    { 0x80247150L, L"WU_E_METADATATRUST_CERTIFICATECHAIN_VERIFICATION\r\n(An failure occurred while verifying trust for metadata signing certificate chains)" },
+    { 0x80247151L, L"WU_E_METADATATRUST_UNTRUSTED_CERTIFICATECHAIN\r\n(A metadata signing certificate had an untrusted certificate chain)" },
+
+    ///////
+    // Metadata Timestamp Token/Signature errors 0x7160 - 0x717F
+    ///////
+    { 0x80247160L, L"WU_E_METADATA_TIMESTAMP_TOKEN_MISSING\r\n(An expected metadata timestamp token was missing)" },
+    { 0x80247161L, L"WU_E_METADATA_TIMESTAMP_TOKEN_VERIFICATION_FAILED\r\n(A metadata Timestamp token failed verification)" },
+    { 0x80247162L, L"WU_E_METADATA_TIMESTAMP_TOKEN_UNTRUSTED\r\n(A metadata timestamp token signer certificate chain was untrusted)" },
+    { 0x80247163L, L"WU_E_METADATA_TIMESTAMP_TOKEN_VALIDITY_WINDOW\r\n(A metadata signature timestamp token was no longer within the validity window)" },
+    { 0x80247164L, L"WU_E_METADATA_TIMESTAMP_TOKEN_SIGNATURE\r\n(A metadata timestamp token failed signature validation)" },
+    { 0x80247165L, L"WU_E_METADATA_TIMESTAMP_TOKEN_CERTCHAIN\r\n(A metadata timestamp token certificate failed certificate chain verification)" },
+    { 0x80247166L, L"WU_E_METADATA_TIMESTAMP_TOKEN_REFRESHONLINE\r\n(A failure occurred when refreshing a missing timestamp token from the network)" },
+    { 0x80247167L, L"WU_E_METADATA_TIMESTAMP_TOKEN_ALL_BAD\r\n(All update metadata verification timestamp tokens from the timestamp token cache are invalid)" },
+    { 0x80247168L, L"WU_E_METADATA_TIMESTAMP_TOKEN_NODATA\r\n(No update metadata verification timestamp tokens exist in the timestamp token cache)" },
+    { 0x80247169L, L"WU_E_METADATA_TIMESTAMP_TOKEN_CACHELOOKUP\r\n(An error occurred during cache lookup of update metadata verification timestamp token)" },
+    { 0x8024717EL, L"WU_E_METADATA_TIMESTAMP_TOKEN_VALIDITYWINDOW_UNEXPECTED\r\n(An metadata timestamp token validity window failed unexpectedly due to reasons not covered by another error code)" },
+    { 0x8024717FL, L"WU_E_METADATA_TIMESTAMP_TOKEN_UNEXPECTED\r\n(An metadata timestamp token verification operation failed due to reasons not covered by another error code)" },
+
+    ///////
+    // Metadata Certificate-Related errors 0x7180 - 0x719F
+    ///////
+    { 0x80247180L, L"WU_E_METADATA_CERT_MISSING\r\n(An expected metadata signing certificate was missing)" },
+    { 0x80247181L, L"WU_E_METADATA_LEAFCERT_BAD_TRANSPORT_ENCODING\r\n(The transport encoding of a metadata signing leaf certificate was malformed)" },
+    { 0x80247182L, L"WU_E_METADATA_INTCERT_BAD_TRANSPORT_ENCODING\r\n(The transport encoding of a metadata signing intermediate certificate was malformed)" },
+    { 0x80247183L, L"WU_E_METADATA_CERT_UNTRUSTED\r\n(A metadata certificate chain was untrusted)" },
+    { 0x80247FFFL, L"WU_E_OL_UNEXPECTED\r\n(Search using the scan package failed)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // data store errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x80248000L, L"WU_E_DS_SHUTDOWN\r\n(An operation failed because Windows Update Agent is shutting down)" },
+    { 0x80248001L, L"WU_E_DS_INUSE\r\n(An operation failed because the data store was in use)" },
+    { 0x80248002L, L"WU_E_DS_INVALID\r\n(The current and expected states of the data store do not match)" },
+    { 0x80248003L, L"WU_E_DS_TABLEMISSING\r\n(The data store is missing a table)" },
+    { 0x80248004L, L"WU_E_DS_TABLEINCORRECT\r\n(The data store contains a table with unexpected columns)" },
+    { 0x80248005L, L"WU_E_DS_INVALIDTABLENAME\r\n(A table could not be opened because the table is not in the data store)" },
+    { 0x80248006L, L"WU_E_DS_BADVERSION\r\n(The current and expected versions of the data store do not match)" },
+    { 0x80248007L, L"WU_E_DS_NODATA\r\n(The information requested is not in the data store)" },
+    { 0x80248008L, L"WU_E_DS_MISSINGDATA\r\n(The data store is missing required information or has a NULL in a table column that requires a non-null value)" },
+    { 0x80248009L, L"WU_E_DS_MISSINGREF\r\n(The data store is missing required information or has a reference to missing license terms, file, localized property or linked row)" },
+    { 0x8024800AL, L"WU_E_DS_UNKNOWNHANDLER\r\n(The update was not processed because its update handler could not be recognized)" },
+    { 0x8024800BL, L"WU_E_DS_CANTDELETE\r\n(The update was not deleted because it is still referenced by one or more services)" },
+    { 0x8024800CL, L"WU_E_DS_LOCKTIMEOUTEXPIRED\r\n(The data store section could not be locked within the allotted time)" },
+    { 0x8024800DL, L"WU_E_DS_NOCATEGORIES\r\n(The category was not added because it contains no parent categories and is not a top-level category itself)" },
+    { 0x8024800EL, L"WU_E_DS_ROWEXISTS\r\n(The row was not added because an existing row has the same primary key)" },
+    { 0x8024800FL, L"WU_E_DS_STOREFILELOCKED\r\n(The data store could not be initialized because it was locked by another process)" },
+    { 0x80248010L, L"WU_E_DS_CANNOTREGISTER\r\n(The data store is not allowed to be registered with COM in the current process)" },
+    { 0x80248011L, L"WU_E_DS_UNABLETOSTART\r\n(Could not create a data store object in another process)" },
+    { 0x80248013L, L"WU_E_DS_DUPLICATEUPDATEID\r\n(The server sent the same update to the client with two different revision IDs)" },
+    { 0x80248014L, L"WU_E_DS_UNKNOWNSERVICE\r\n(An operation did not complete because the service is not in the data store)" },
+    { 0x80248015L, L"WU_E_DS_SERVICEEXPIRED\r\n(An operation did not complete because the registration of the service has expired)" },
+    { 0x80248016L, L"WU_E_DS_DECLINENOTALLOWED\r\n(A request to hide an update was declined because it is a mandatory update or because it was deployed with a deadline)" },
+    { 0x80248017L, L"WU_E_DS_TABLESESSIONMISMATCH\r\n(A table was not closed because it is not associated with the session)" },
+    { 0x80248018L, L"WU_E_DS_SESSIONLOCKMISMATCH\r\n(A table was not closed because it is not associated with the session)" },
+    { 0x80248019L, L"WU_E_DS_NEEDWINDOWSSERVICE\r\n(A request to remove the Windows Update service or to unregister it with Automatic Updates was declined because it is a built-in service and/or Automatic Updates cannot fall back to another service)" },
+    { 0x8024801AL, L"WU_E_DS_INVALIDOPERATION\r\n(A request was declined because the operation is not allowed)" },
+    { 0x8024801BL, L"WU_E_DS_SCHEMAMISMATCH\r\n(The schema of the current data store and the schema of a table in a backup XML document do not match)" },
+    { 0x8024801CL, L"WU_E_DS_RESETREQUIRED\r\n(The data store requires a session reset; release the session and retry with a new session)" },
+    { 0x8024801DL, L"WU_E_DS_IMPERSONATED\r\n(A data store operation did not complete because it was requested with an impersonated identity)" },
+    { 0x8024801EL, L"WU_E_DS_DATANOTAVAILABLE\r\n(An operation against update metadata did not complete because the data was never received from server)" },
+    { 0x8024801FL, L"WU_E_DS_DATANOTLOADED\r\n(An operation against update metadata did not complete because the data was available but not loaded from datastore)" },
+    { 0x80248020L, L"WU_E_DS_NODATA_NOSUCHREVISION\r\n(A data store operation did not complete because no such update revision is known)" },
+    { 0x80248021L, L"WU_E_DS_NODATA_NOSUCHUPDATE\r\n(A data store operation did not complete because no such update is known)" },
+    { 0x80248022L, L"WU_E_DS_NODATA_EULA\r\n(A data store operation did not complete because an update's EULA information is missing)" },
+    { 0x80248023L, L"WU_E_DS_NODATA_SERVICE\r\n(A data store operation did not complete because a service's information is missing)" },
+    { 0x80248024L, L"WU_E_DS_NODATA_COOKIE\r\n(A data store operation did not complete because a service's synchronization information is missing)" },
+    { 0x80248025L, L"WU_E_DS_NODATA_TIMER\r\n(A data store operation did not complete because a timer's information is missing)" },
+    { 0x80248026L, L"WU_E_DS_NODATA_CCR\r\n(A data store operation did not complete because a download's information is missing)" },
+    { 0x80248027L, L"WU_E_DS_NODATA_FILE\r\n(A data store operation did not complete because a file's information is missing)" },
+    { 0x80248028L, L"WU_E_DS_NODATA_DOWNLOADJOB\r\n(A data store operation did not complete because a download job's information is missing)" },
+    { 0x80248029L, L"WU_E_DS_NODATA_TMI\r\n(A data store operation did not complete because a service's timestamp information is missing)" },
+    { 0x80248FFFL, L"WU_E_DS_UNEXPECTED\r\n(A data store error not covered by another WU_E_DS_* code)" },
+
+    /////////////////////////////////////////////////////////////////////////////
+    //Inventory Errors
+    /////////////////////////////////////////////////////////////////////////////
+    { 0x80249001L, L"WU_E_INVENTORY_PARSEFAILED\r\n(Parsing of the rule file failed)" },
+    { 0x80249002L, L"WU_E_INVENTORY_GET_INVENTORY_TYPE_FAILED\r\n(Failed to get the requested inventory type from the server)" },
+    { 0x80249003L, L"WU_E_INVENTORY_RESULT_UPLOAD_FAILED\r\n(Failed to upload inventory result to the server)" },
+    { 0x80249004L, L"WU_E_INVENTORY_UNEXPECTED\r\n(There was an inventory error not covered by another error code)" },
+    { 0x80249005L, L"WU_E_INVENTORY_WMI_ERROR\r\n(A WMI error occurred when enumerating the instances for a particular class)" },
+
+    /////////////////////////////////////////////////////////////////////////////
+    //AU Errors
+    /////////////////////////////////////////////////////////////////////////////
+    { 0x8024A000L, L"WU_E_AU_NOSERVICE\r\n(Automatic Updates was unable to service incoming requests)" },
+    { 0x8024A002L, L"WU_E_AU_NONLEGACYSERVER\r\n(The old version of the Automatic Updates client has stopped because the WSUS server has been upgraded)" },
+    { 0x8024A003L, L"WU_E_AU_LEGACYCLIENTDISABLED\r\n(The old version of the Automatic Updates client was disabled)" },
+    { 0x8024A004L, L"WU_E_AU_PAUSED\r\n(Automatic Updates was unable to process incoming requests because it was paused)" },
+    { 0x8024A005L, L"WU_E_AU_NO_REGISTERED_SERVICE\r\n(No unmanaged service is registered with AU)" },
+    { 0x8024A006L, L"WU_E_AU_DETECT_SVCID_MISMATCH\r\n(The default service registered with AU changed during the search)" },
+    { 0x8024A007L, L"WU_E_REBOOT_IN_PROGRESS\r\n(A reboot is in progress)" },
+    { 0x8024A008L, L"WU_E_AU_OOBE_IN_PROGRESS\r\n(Automatic Updates can't process incoming requests while Windows Welcome is running)" },
+    { 0x8024AFFFL, L"WU_E_AU_UNEXPECTED\r\n(An Automatic Updates error not covered by another WU_E_AU * code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // WU Task related errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x8024B001L, L"WU_E_WUTASK_INPROGRESS\r\n(The task is currently in progress)" },
+    { 0x8024B002L, L"WU_E_WUTASK_STATUS_DISABLED\r\n(The operation cannot be completed since the task status is currently disabled)" },
+    { 0x8024B003L, L"WU_E_WUTASK_NOT_STARTED\r\n(The operation cannot be completed since the task is not yet started)" },
+    { 0x8024B004L, L"WU_E_WUTASK_RETRY\r\n(The task was stopped and needs to be run again to complete)" },
+    { 0x8024B005L, L"WU_E_WUTASK_CANCELINSTALL_DISALLOWED\r\n(Cannot cancel a non-scheduled install)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // Hardware Capability related errors
+    ////
+    { 0x8024B101L, L"WU_E_UNKNOWN_HARDWARECAPABILITY\r\n(Hardware capability meta data was not found after a sync with the service)" },
+    { 0x8024B102L, L"WU_E_BAD_XML_HARDWARECAPABILITY\r\n(Hardware capability meta data was malformed and/or failed to parse)" },
+    { 0x8024B103L, L"WU_E_WMI_NOT_SUPPORTED\r\n(Unable to complete action due to WMI dependency, which isn't supported on this platform)" },
+    { 0x8024B104L, L"WU_E_UPDATE_MERGE_NOT_ALLOWED\r\n(Merging of the update is not allowed)" },
+    { 0x8024B105L, L"WU_E_SKIPPED_UPDATE_INSTALLATION\r\n(Installing merged updates only. So skipping non mergeable updates)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // SLS related errors - 0xB201
+    ////
+    ///////
+    // SLS General errors 0xB201 - 0xB2FF
+    ///////
+    { 0x8024B201L, L"WU_E_SLS_INVALID_REVISION\r\n(SLS response returned invalid revision number)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // trust related errors - 0xB301
+    ////
+    ///////
+    // trust General errors 0xB301 - 0xB3FF
+    ///////
+    { 0x8024B301L, L"WU_E_FILETRUST_DUALSIGNATURE_RSA\r\n(File signature validation fails to find valid RSA signature on infrastructure payload)" },
+    { 0x8024B302L, L"WU_E_FILETRUST_DUALSIGNATURE_ECC\r\n(File signature validation fails to find valid ECC signature on infrastructure payload)" },
+    { 0x8024B303L, L"WU_E_TRUST_SUBJECT_NOT_TRUSTED\r\n(The subject is not trusted by WU for the specified action)" },
+    { 0x8024B304L, L"WU_E_TRUST_PROVIDER_UNKNOWN\r\n(Unknown trust provider for WU)" },
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // driver util errors
+    //
+    // The device PnP enumerated device was pruned from the SystemSpec because
+    // one of the hardware or compatible IDs matched an installed printer driver.
+    // This is not considered a fatal error and the device is simply skipped.
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x8024C001L, L"WU_E_DRV_PRUNED\r\n(A driver was skipped)" },
+    { 0x8024C002L, L"WU_E_DRV_NOPROP_OR_LEGACY\r\n(A property for the driver could not be found. It may not conform with required specifications)" },
+    { 0x8024C003L, L"WU_E_DRV_REG_MISMATCH\r\n(The registry type read for the driver does not match the expected type)" },
+    { 0x8024C004L, L"WU_E_DRV_NO_METADATA\r\n(The driver update is missing metadata)" },
+    { 0x8024C005L, L"WU_E_DRV_MISSING_ATTRIBUTE\r\n(The driver update is missing a required attribute)" },
+    { 0x8024C006L, L"WU_E_DRV_SYNC_FAILED\r\n(Driver synchronization failed)" },
+    { 0x8024C007L, L"WU_E_DRV_NO_PRINTER_CONTENT\r\n(Information required for the synchronization of applicable printers is missing)" },
+    { 0x8024C008L, L"WU_E_DRV_DEVICE_PROBLEM\r\n(After installing a driver update, the updated device has reported a problem)" },
+
+    // MessageId 0xCE00 through 0xCEFF are reserved for post-install driver problem codes
+    // (see uhdriver.cpp)
+    { 0x8024CFFFL, L"WU_E_DRV_UNEXPECTED\r\n(A driver error not covered by another WU_E_DRV_* code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // Setup/SelfUpdate errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x8024D001L, L"WU_E_SETUP_INVALID_INFDATA\r\n(Windows Update Agent could not be updated because an INF file contains invalid information)" },
+    { 0x8024D002L, L"WU_E_SETUP_INVALID_IDENTDATA\r\n(Windows Update Agent could not be updated because the wuident.cab file contains invalid information)" },
+    { 0x8024D003L, L"WU_E_SETUP_ALREADY_INITIALIZED\r\n(Windows Update Agent could not be updated because of an internal error that caused setup initialization to be performed twice)" },
+    { 0x8024D004L, L"WU_E_SETUP_NOT_INITIALIZED\r\n(Windows Update Agent could not be updated because setup initialization never completed successfully)" },
+    { 0x8024D005L, L"WU_E_SETUP_SOURCE_VERSION_MISMATCH\r\n(Windows Update Agent could not be updated because the versions specified in the INF do not match the actual source file versions)" },
+    { 0x8024D006L, L"WU_E_SETUP_TARGET_VERSION_GREATER\r\n(Windows Update Agent could not be updated because a WUA file on the target system is newer than the corresponding source file)" },
+    { 0x8024D007L, L"WU_E_SETUP_REGISTRATION_FAILED\r\n(Windows Update Agent could not be updated because regsvr32.exe returned an error)" },
+    { 0x8024D008L, L"WU_E_SELFUPDATE_SKIP_ON_FAILURE\r\n(An update to the Windows Update Agent was skipped because previous attempts to update have failed)" },
+    { 0x8024D009L, L"WU_E_SETUP_SKIP_UPDATE\r\n(An update to the Windows Update Agent was skipped due to a directive in the wuident.cab file)" },
+    { 0x8024D00AL, L"WU_E_SETUP_UNSUPPORTED_CONFIGURATION\r\n(Windows Update Agent could not be updated because the current system configuration is not supported)" },
+    { 0x8024D00BL, L"WU_E_SETUP_BLOCKED_CONFIGURATION\r\n(Windows Update Agent could not be updated because the system is configured to block the update)" },
+    { 0x8024D00CL, L"WU_E_SETUP_REBOOT_TO_FIX\r\n(Windows Update Agent could not be updated because a restart of the system is required)" },
+    { 0x8024D00DL, L"WU_E_SETUP_ALREADYRUNNING\r\n(Windows Update Agent setup is already running)" },
+    { 0x8024D00EL, L"WU_E_SETUP_REBOOTREQUIRED\r\n(Windows Update Agent setup package requires a reboot to complete installation)" },
+    { 0x8024D00FL, L"WU_E_SETUP_HANDLER_EXEC_FAILURE\r\n(Windows Update Agent could not be updated because the setup handler failed during execution)" },
+    { 0x8024D010L, L"WU_E_SETUP_INVALID_REGISTRY_DATA\r\n(Windows Update Agent could not be updated because the registry contains invalid information)" },
+    { 0x8024D011L, L"WU_E_SELFUPDATE_REQUIRED\r\n(Windows Update Agent must be updated before search can continue)" },
+    { 0x8024D012L, L"WU_E_SELFUPDATE_REQUIRED_ADMIN\r\n(Windows Update Agent must be updated before search can continue.  An administrator is required to perform the operation)" },
+    { 0x8024D013L, L"WU_E_SETUP_WRONG_SERVER_VERSION\r\n(Windows Update Agent could not be updated because the server does not contain update information for this version)" },
+    { 0x8024D014L, L"WU_E_SETUP_DEFERRABLE_REBOOT_PENDING\r\n(Windows Update Agent is successfully updated, but a reboot is required to complete the setup)" },
+    { 0x8024D015L, L"WU_E_SETUP_NON_DEFERRABLE_REBOOT_PENDING\r\n(Windows Update Agent is successfully updated, but a reboot is required to complete the setup)" },
+    { 0x8024D016L, L"WU_E_SETUP_FAIL\r\n(Windows Update Agent could not be updated because of an unknown error)" },
+    { 0x8024DFFFL, L"WU_E_SETUP_UNEXPECTED\r\n(Windows Update Agent could not be updated because of an error not covered by another WU_E_SETUP_* error code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // expression evaluator errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x8024E001L, L"WU_E_EE_UNKNOWN_EXPRESSION\r\n(An expression evaluator operation could not be completed because an expression was unrecognized)" },
+    { 0x8024E002L, L"WU_E_EE_INVALID_EXPRESSION\r\n(An expression evaluator operation could not be completed because an expression was invalid)" },
+    { 0x8024E003L, L"WU_E_EE_MISSING_METADATA\r\n(An expression evaluator operation could not be completed because an expression contains an incorrect number of metadata nodes)" },
+    { 0x8024E004L, L"WU_E_EE_INVALID_VERSION\r\n(An expression evaluator operation could not be completed because the version of the serialized expression data is invalid)" },
+    { 0x8024E005L, L"WU_E_EE_NOT_INITIALIZED\r\n(The expression evaluator could not be initialized)" },
+    { 0x8024E006L, L"WU_E_EE_INVALID_ATTRIBUTEDATA\r\n(An expression evaluator operation could not be completed because there was an invalid attribute)" },
+    { 0x8024E007L, L"WU_E_EE_CLUSTER_ERROR\r\n(An expression evaluator operation could not be completed because the cluster state of the computer could not be determined)" },
+    { 0x8024EFFFL, L"WU_E_EE_UNEXPECTED\r\n(There was an expression evaluator error not covered by another WU_E_EE_* error code)" },
+
+    //////////////////////////////////////////////////////////////////////////////
+    // reporter errors
+    ///////////////////////////////////////////////////////////////////////////////
+    { 0x8024F001L, L"WU_E_REPORTER_EVENTCACHECORRUPT\r\n(The event cache file was defective)" },
+    { 0x8024F002L, L"WU_E_REPORTER_EVENTNAMESPACEPARSEFAILED\r\n(The XML in the event namespace descriptor could not be parsed)" },
+    { 0x8024F003L, L"WU_E_INVALID_EVENT\r\n(The XML in the event namespace descriptor could not be parsed)" },
+    { 0x8024F004L, L"WU_E_SERVER_BUSY\r\n(The server rejected an event because the server was too busy)" },
+    { 0x8024F005L, L"WU_E_CALLBACK_COOKIE_NOT_FOUND\r\n(The specified callback cookie is not found)" },
+    { 0x8024FFFFL, L"WU_E_REPORTER_UNEXPECTED\r\n(There was a reporter error not covered by another error code)" },
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getSourceName
+
+  Summary:  Get display name for an error code source
+
+  Args:     ErrorSource source
+              Source
+
+  Returns:  const wchar_t*
+
+-----------------------------------------------------------------F-F*/
+const wchar_t* getSourceName(ErrorSource source) {
+    switch (source) {
+        case SOURCE_WIN32: return L"Win32/HRESULT";
+        case SOURCE_NTSTATUS: return L"NTSTATUS";
+        case SOURCE_WU: return L"WU";
+        case SOURCE_LDAP: return L"LDAP";
+        case SOURCE_BUGCHECK: return L"StopCode/BugCheck";
+        case SOURCE_WININET: return L"Wininet";
+        default: return L"";
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getSourceByName
+
+  Summary:  Get error code source for a display name (case insensitive)
+
+  Args:     const wchar_t* szName
+              Display name
+            ErrorSource* pSource
+              Receives the source
+
+  Returns:  bool
+              true = Source was found
+
+-----------------------------------------------------------------F-F*/
+bool getSourceByName(const wchar_t* szName, ErrorSource* pSource) {
+    for (int source = 0; source < SOURCE_COUNT; source++) {
+        if (_wcsicmp(szName, getSourceName((ErrorSource)source)) == 0) {
+            *pSource = (ErrorSource)source;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getPerfectHash
+
+  Summary:  Hash function for the perfect hash (MurmurHash3 finalizer)
+
+  Args:     DWORD dwValue
+              Value
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+constexpr DWORD getPerfectHash(DWORD dwValue) {
+    dwValue ^= dwValue >> 16;
+    dwValue *= 0x85EBCA6B;
+    dwValue ^= dwValue >> 13;
+    dwValue *= 0xC2B2AE35;
+    dwValue ^= dwValue >> 16;
+    return dwValue;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getPerfectHashBucket
+
+  Summary:  Get bucket for a code (hash scaled to 0...buckets-1 without division)
+
+  Args:     DWORD dwCode
+              Error code
+            size_t buckets
+              Number of buckets
+
+  Returns:  size_t
+
+-----------------------------------------------------------------F-F*/
+constexpr size_t getPerfectHashBucket(DWORD dwCode, size_t buckets) {
+    return (size_t)(((ULONGLONG)getPerfectHash(dwCode) * buckets) >> 32);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getPerfectHashSlot
+
+  Summary:  Get slot for a code and the displacement of its bucket
+
+  Args:     DWORD dwCode
+              Error code
+            DWORD dwDisplacement
+              Displacement of the bucket
+            size_t slots
+              Number of slots
+
+  Returns:  size_t
+
+-----------------------------------------------------------------F-F*/
+constexpr size_t getPerfectHashSlot(DWORD dwCode, DWORD dwDisplacement, size_t slots) {
+    return (size_t)(((ULONGLONG)getPerfectHash(dwCode + 0x7F4A7C15u + dwDisplacement * 0x9E3779B9u) * slots) >> 32);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isValidCodeTable
+
+  Summary:  Check a table at compile time: Not empty, codes strictly
+            ascending (so no duplicates) and no empty text
+
+  Args:     const ErrorCodeEntry* pEntries
+              Table
+            size_t count
+              Number of entries
+
+  Returns:  bool
+
+-----------------------------------------------------------------F-F*/
+constexpr bool isValidCodeTable(const ErrorCodeEntry* pEntries, size_t count) {
+    if (count == 0) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (pEntries[i].text.empty()) return false;
+        if ((i > 0) && (pEntries[i].code <= pEntries[i - 1].code)) return false;
+    }
+    return true;
+}
+
+// Tables with a duplicate or unsorted code do not compile. The perfect
+// hash and the lookups rely on this and do not check it again.
+static_assert(isValidCodeTable(c_aBugCheckCodes, _countof(c_aBugCheckCodes)), "c_aBugCheckCodes is empty, not sorted by code, has a duplicate code or an empty text");
+static_assert(isValidCodeTable(c_aWininetCodes, _countof(c_aWininetCodes)), "c_aWininetCodes is empty, not sorted by code, has a duplicate code or an empty text");
+static_assert(isValidCodeTable(c_aLDAPCodes, _countof(c_aLDAPCodes)), "c_aLDAPCodes is empty, not sorted by code, has a duplicate code or an empty text");
+static_assert(isValidCodeTable(c_aWUCodes, _countof(c_aWUCodes)), "c_aWUCodes is empty, not sorted by code, has a duplicate code or an empty text");
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getBucketCount
+
+  Summary:  Get number of buckets for the perfect hash
+
+  Args:     size_t slots
+              Number of codes
+
+  Returns:  size_t
+
+-----------------------------------------------------------------F-F*/
+constexpr size_t getBucketCount(size_t slots) {
+    return (slots + PERFECTHASHBUCKETSIZE - 1) / PERFECTHASHBUCKETSIZE;
+}
+
+// Displacements and slots of a perfect hash
+template <size_t BUCKETS, size_t SLOTS>
+struct PerfectHash {
+    WORD displacements[BUCKETS];
+    ErrorCodeEntry slots[SLOTS];
+    bool bValid; // false = No displacement found for a bucket
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: buildPerfectHash
+
+  Summary:  Build minimal perfect hash for a sorted table (at compile time).
+            Buckets with many codes are placed first, for each bucket the
+            first displacement moving all its codes to free slots is used.
+
+  Args:     const ErrorCodeEntry* pEntries
+              Table (checked by isValidCodeTable)
+            size_t count
+              Number of entries (= SLOTS)
+
+  Returns:  PerfectHash<BUCKETS, SLOTS>
+
+-----------------------------------------------------------------F-F*/
+template <size_t BUCKETS, size_t SLOTS>
+constexpr PerfectHash<BUCKETS, SLOTS> buildPerfectHash(const ErrorCodeEntry* pEntries, size_t count) {
+    PerfectHash<BUCKETS, SLOTS> hash = {};
+    size_t bucketStart[BUCKETS + 1] = {};
+    size_t members[SLOTS] = {}; // Entry indices grouped by bucket
+    size_t fill[BUCKETS] = {};
+    bool bUsed[SLOTS] = {};
+
+    // Group codes by bucket
+    for (size_t i = 0; i < count; i++) {
+        bucketStart[getPerfectHashBucket(pEntries[i].code, BUCKETS) + 1]++;
+    }
+    size_t maxBucketSize = 0;
+    for (size_t b = 0; b < BUCKETS; b++) {
+        if (bucketStart[b + 1] > maxBucketSize) maxBucketSize = bucketStart[b + 1];
+        bucketStart[b + 1] += bucketStart[b];
+    }
+    for (size_t i = 0; i < count; i++) {
+        size_t b = getPerfectHashBucket(pEntries[i].code, BUCKETS);
+        members[bucketStart[b] + fill[b]++] = i;
+    }
+
+    // Place buckets, largest first
+    for (size_t size = maxBucketSize; size > 0; size--) {
+        for (size_t b = 0; b < BUCKETS; b++) {
+            if (bucketStart[b + 1] - bucketStart[b] != size) continue;
+            DWORD dwDisplacement = 0;
+            for (;;) {
+                size_t placed = 0;
+                while (placed < size) {
+                    size_t slot = getPerfectHashSlot(pEntries[members[bucketStart[b] + placed]].code, dwDisplacement, SLOTS);
+                    if (bUsed[slot]) break;
+                    bUsed[slot] = true;
+                    placed++;
+                }
+                if (placed == size) break;
+                while (placed > 0) { // Undo
+                    placed--;
+                    bUsed[getPerfectHashSlot(pEntries[members[bucketStart[b] + placed]].code, dwDisplacement, SLOTS)] = false;
+                }
+                if (++dwDisplacement > 0xFFFF) return hash; // bValid is false
+            }
+            hash.displacements[b] = (WORD)dwDisplacement;
+            for (size_t i = bucketStart[b]; i < bucketStart[b + 1]; i++) {
+                hash.slots[getPerfectHashSlot(pEntries[members[i]].code, dwDisplacement, SLOTS)] = pEntries[members[i]];
+            }
+        }
+    }
+    hash.bValid = true;
+    return hash;
+}
+
+// Perfect hashes for the tables
+constexpr size_t c_BugCheckSlots = _countof(c_aBugCheckCodes);
+constexpr PerfectHash<getBucketCount(c_BugCheckSlots), c_BugCheckSlots> c_hashBugCheck = buildPerfectHash<getBucketCount(c_BugCheckSlots), c_BugCheckSlots>(c_aBugCheckCodes, _countof(c_aBugCheckCodes));
+static_assert(c_hashBugCheck.bValid, "No perfect hash for c_aBugCheckCodes");
+constexpr size_t c_WininetSlots = _countof(c_aWininetCodes);
+constexpr PerfectHash<getBucketCount(c_WininetSlots), c_WininetSlots> c_hashWininet = buildPerfectHash<getBucketCount(c_WininetSlots), c_WininetSlots>(c_aWininetCodes, _countof(c_aWininetCodes));
+static_assert(c_hashWininet.bValid, "No perfect hash for c_aWininetCodes");
+constexpr size_t c_LDAPSlots = _countof(c_aLDAPCodes);
+constexpr PerfectHash<getBucketCount(c_LDAPSlots), c_LDAPSlots> c_hashLDAP = buildPerfectHash<getBucketCount(c_LDAPSlots), c_LDAPSlots>(c_aLDAPCodes, _countof(c_aLDAPCodes));
+static_assert(c_hashLDAP.bValid, "No perfect hash for c_aLDAPCodes");
+constexpr size_t c_WUSlots = _countof(c_aWUCodes);
+constexpr PerfectHash<getBucketCount(c_WUSlots), c_WUSlots> c_hashWU = buildPerfectHash<getBucketCount(c_WUSlots), c_WUSlots>(c_aWUCodes, _countof(c_aWUCodes));
+static_assert(c_hashWU.bValid, "No perfect hash for c_aWUCodes");
+
+// Tables used by the lookup functions
+const ErrorCodeTable g_tblBugCheck = { c_aBugCheckCodes, _countof(c_aBugCheckCodes), c_hashBugCheck.displacements, _countof(c_hashBugCheck.displacements), c_hashBugCheck.slots, _countof(c_hashBugCheck.slots) };
+const ErrorCodeTable g_tblWininet = { c_aWininetCodes, _countof(c_aWininetCodes), c_hashWininet.displacements, _countof(c_hashWininet.displacements), c_hashWininet.slots, _countof(c_hashWininet.slots) };
+const ErrorCodeTable g_tblLDAP = { c_aLDAPCodes, _countof(c_aLDAPCodes), c_hashLDAP.displacements, _countof(c_hashLDAP.displacements), c_hashLDAP.slots, _countof(c_hashLDAP.slots) };
+const ErrorCodeTable g_tblWU = { c_aWUCodes, _countof(c_aWUCodes), c_hashWU.displacements, _countof(c_hashWU.displacements), c_hashWU.slots, _countof(c_hashWU.slots) };
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getSourceTable
+
+  Summary:  Get built-in table for an error code source
+
+  Args:     ErrorSource source
+              Source
+
+  Returns:  const ErrorCodeTable*
+              Table or NULL for sources without a built-in table (Win32/HRESULT, NTSTATUS)
+
+-----------------------------------------------------------------F-F*/
+const ErrorCodeTable* getSourceTable(ErrorSource source) {
+    switch (source) {
+        case SOURCE_WU: return &g_tblWU;
+        case SOURCE_LDAP: return &g_tblLDAP;
+        case SOURCE_BUGCHECK: return &g_tblBugCheck;
+        case SOURCE_WININET: return &g_tblWininet;
+        default: return NULL;
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ErrorCodeTable::find
+
+  Summary:  Lookup error code with the perfect hash (one probe)
+
+  Args:     DWORD dwCode
+              Error code
+
+  Returns:  std::wstring_view
+              Text or empty view, if the code is not in the table
+
+-----------------------------------------------------------------F-F*/
+std::wstring_view ErrorCodeTable::find(DWORD dwCode) const {
+    const ErrorCodeEntry& slot = pSlots[getPerfectHashSlot(dwCode, pDisplacements[getPerfectHashBucket(dwCode, buckets)], slots)];
+    if (slot.code == dwCode) return slot.text; else return std::wstring_view();
+}
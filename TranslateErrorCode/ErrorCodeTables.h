@@ -0,0 +1,49 @@
+#pragma once
+
+#include "framework.h"
+#include <string_view>
+
+// Sources for error code texts
+enum ErrorSource {
+    SOURCE_WIN32,
+    SOURCE_NTSTATUS,
+    SOURCE_WU,
+    SOURCE_LDAP,
+    SOURCE_BUGCHECK,
+    SOURCE_WININET,
+    SOURCE_COUNT
+};
+
+// Error code definition. The text is a view of a string literal, so the
+// length is known at compile time and the text is zero terminated.
+struct ErrorCodeEntry {
+    DWORD code;
+    std::wstring_view text;
+};
+
+// Average number of codes per bucket of the perfect hash
+#define PERFECTHASHBUCKETSIZE 2
+
+// Constant table with error code definitions, strictly sorted by code
+// (checked at compile time). Lookups use
+// a minimal perfect hash built at compile time: The bucket of a code
+// selects a displacement, code and displacement select the slot of the code.
+struct ErrorCodeTable {
+    const ErrorCodeEntry* pEntries;
+    size_t count;
+    const WORD* pDisplacements;
+    size_t buckets;
+    const ErrorCodeEntry* pSlots;  // One slot for each code
+    size_t slots;
+
+    std::wstring_view find(DWORD dwCode) const;
+};
+
+extern const ErrorCodeTable g_tblWU;
+extern const ErrorCodeTable g_tblLDAP;
+extern const ErrorCodeTable g_tblBugCheck;
+extern const ErrorCodeTable g_tblWininet;
+
+const wchar_t* getSourceName(ErrorSource source);
+bool getSourceByName(const wchar_t* szName, ErrorSource* pSource);
+const ErrorCodeTable* getSourceTable(ErrorSource source);
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "framework.h"
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+
+// ETW provider "CodingABI.TranslateErrorCode" {c5a1a43f-0685-5fd5-7cc9-fc389997c734}
+TRACELOGGING_DECLARE_PROVIDER(g_hTraceProvider);
+
+// Measured stages of a lookup
+enum LookupStage {
+    STAGE_PARSE,         // Parse input
+    STAGE_INDEX,         // Probe in the code index
+    STAGE_TABLE,         // Probe in the perfect hash of a built-in table
+    STAGE_SNAPSHOT,      // Search in the message snapshot (other languages)
+    STAGE_FORMATMESSAGE, // FormatMessage after a cache miss
+    STAGE_OUTPUT,        // Write result (SetWindowText or batch output)
+    STAGE_COUNT
+};
+
+// Counters and timings (QueryPerformanceCounter ticks) of one engine
+struct LookupStats {
+    ULONGLONG lookups;
+    ULONGLONG results;
+    ULONGLONG indexHits;
+    ULONGLONG indexMisses;
+    ULONGLONG cacheHits;
+    ULONGLONG cacheMisses;
+    ULONGLONG stageCalls[STAGE_COUNT];
+    ULONGLONG stageTicks[STAGE_COUNT];
+    void add(const LookupStats& other);
+};
+
+extern bool g_bCollectStats; // Set before the first lookup (/stats)
+
+// true = Stats are collected or an ETW session listens. When disabled,
+// the instrumentation costs this check only.
+inline bool isInstrumented() {
+    return g_bCollectStats || TraceLoggingProviderEnabled(g_hTraceProvider, WINEVENT_LEVEL_VERBOSE, 0);
+}
+
+inline ULONGLONG getTicks() {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (ULONGLONG)counter.QuadPart;
+}
+
+ULONGLONG ticksToMicroseconds(ULONGLONG ticks);
+const wchar_t* getStageName(LookupStage stage);
+
+// Measures a stage from construction to destruction, when the
+// instrumentation is enabled, and writes an ETW event "Stage"
+class StageTimer {
+public:
+    StageTimer(LookupStats& stats, LookupStage stage) : m_pStats(isInstrumented() ? &stats : NULL), m_stage(stage), m_start(0) {
+        if (m_pStats != NULL) m_start = getTicks();
+    }
+    ~StageTimer() {
+        if (m_pStats == NULL) return;
+        ULONGLONG ticks = getTicks() - m_start;
+        m_pStats->stageCalls[m_stage]++;
+        m_pStats->stageTicks[m_stage] += ticks;
+        TraceLoggingWrite(g_hTraceProvider, "Stage", TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingWideString(getStageName(m_stage), "Stage"),
+            TraceLoggingUInt64(ticksToMicroseconds(ticks), "Microseconds"));
+    }
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+private:
+    LookupStats* m_pStats; // NULL = Disabled
+    LookupStage m_stage;
+    ULONGLONG m_start;
+};
+
+void registerTraceProvider();
+void unregisterTraceProvider();
@@ -0,0 +1,262 @@
+﻿/*+===================================================================
+  File:      LiveTranslation.cpp
+
+  Summary:   Translation while typing. The lookup runs on a worker thread
+             with its own engine, so a slow FormatMessage call never blocks
+             the message loop. Each request gets a generation number, results
+             of outdated requests are discarded by the dialog.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "LiveTranslation.h"
+#include "CodeParser.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: formatTranslation
+
+  Summary:  Create output text for an error code (numeric values and
+            texts from all selected sources knowing the error code). 64 bit values
+            without a 32 bit error code (like BugCheck parameters) get
+            only their numeric values.
+
+  Args:     TranslateEngine& engine
+              Engine
+            ULONGLONG qwValue
+              Error code (32 bit, sign extended 32 bit or 64 bit value)
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT)
+            TextBufferSink& sink
+              Receives the text
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void formatTranslation(TranslateEngine& engine, ULONGLONG qwValue, DWORD dwSources, TextBufferSink& sink) {
+    DWORD dwCode;
+    if (!narrowErrorCode(qwValue, &dwCode)) {
+        sink.append(L"QWORD \t");
+        sink.appendUnsigned(qwValue);
+        sink.append(L"\r\nint64 \t");
+        sink.appendSigned((LONGLONG)qwValue);
+        sink.append(L"\r\nHex \t0x");
+        sink.appendHex(qwValue, 16);
+        return;
+    }
+
+    // Numeric values
+    sink.append(L"DWORD \t");
+    sink.appendUnsigned(dwCode);
+    sink.append(L"\r\nint \t");
+    sink.appendSigned((int)dwCode);
+    sink.append(L"\r\nHex \t0x");
+    sink.appendHex(dwCode, 8);
+
+    // Append texts from all selected sources knowing the error code
+    engine.translate(dwCode, sink, dwSources);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::LiveTranslator
+
+  Summary:  Constructor
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+LiveTranslator::LiveTranslator() {
+    InitializeCriticalSection(&m_cs);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::~LiveTranslator
+
+  Summary:  Destructor
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+LiveTranslator::~LiveTranslator() {
+    stop();
+    DeleteCriticalSection(&m_cs);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::setLanguages
+
+  Summary:  Set languages for the engine of the worker thread. Must be
+            called before start().
+
+  Args:     const LANGID* pLangIds
+              Languages
+            size_t count
+              Number of languages (0 = DEFAULTLANGID)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LiveTranslator::setLanguages(const LANGID* pLangIds, size_t count) {
+    if (count > MAXLANGUAGES) count = MAXLANGUAGES;
+    for (size_t i = 0; i < count; i++) m_langIds[i] = pLangIds[i];
+    m_languageCount = count;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::start
+
+  Summary:  Start worker thread
+
+  Args:     HWND hNotify
+              Window receiving WM_APP_TRANSLATED
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool LiveTranslator::start(HWND hNotify) {
+    if (m_hThread != NULL) return true;
+    m_hNotify = hNotify;
+    m_bStop = false;
+    m_bPending = false;
+    m_hEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (m_hEvent == NULL) return false;
+    m_hThread = CreateThread(NULL, 0, threadProc, this, 0, NULL);
+    if (m_hThread == NULL) {
+        CloseHandle(m_hEvent);
+        m_hEvent = NULL;
+        return false;
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::stop
+
+  Summary:  Stop worker thread and release results not yet received
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LiveTranslator::stop() {
+    if (m_hThread == NULL) return;
+    EnterCriticalSection(&m_cs);
+    m_bStop = true;
+    LeaveCriticalSection(&m_cs);
+    SetEvent(m_hEvent);
+    WaitForSingleObject(m_hThread, INFINITE);
+    CloseHandle(m_hThread);
+    CloseHandle(m_hEvent);
+    m_hThread = NULL;
+    m_hEvent = NULL;
+
+    MSG msg;
+    while (PeekMessage(&msg, m_hNotify, WM_APP_TRANSLATED, WM_APP_TRANSLATED, PM_REMOVE)) delete (LiveResult*)msg.lParam;
+    delete m_pSpare;
+    m_pSpare = NULL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::release
+
+  Summary:  Return a received result. One result is kept for the next
+            request, so translating while typing does not allocate a new
+            buffer for each keystroke.
+
+  Args:     LiveResult* pResult
+              Result from WM_APP_TRANSLATED
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LiveTranslator::release(LiveResult* pResult) {
+    if (InterlockedCompareExchangePointer((PVOID volatile*)&m_pSpare, pResult, NULL) != NULL) delete pResult;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::request
+
+  Summary:  Request translation of an error code (replaces a request not
+            yet started)
+
+  Args:     ULONGLONG qwValue
+              Error code (see formatTranslation)
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT)
+
+  Returns:  DWORD
+              Generation of the request
+
+-----------------------------------------------------------------F-F*/
+DWORD LiveTranslator::request(ULONGLONG qwValue, DWORD dwSources) {
+    DWORD dwGeneration = cancel();
+    EnterCriticalSection(&m_cs);
+    m_bPending = true;
+    m_qwPendingValue = qwValue;
+    m_dwPendingSources = dwSources;
+    m_dwPendingGeneration = dwGeneration;
+    LeaveCriticalSection(&m_cs);
+    SetEvent(m_hEvent);
+    return dwGeneration;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::threadProc
+
+  Summary:  Worker thread entry
+
+  Args:     LPVOID lpParameter
+              LiveTranslator*
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+DWORD WINAPI LiveTranslator::threadProc(LPVOID lpParameter) {
+    ((LiveTranslator*)lpParameter)->run();
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LiveTranslator::run
+
+  Summary:  Process requests until stop() is called
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LiveTranslator::run() {
+    TranslateEngine* pEngine = new TranslateEngine(); // Own engine, because engines are not thread safe
+    pEngine->setLanguages(m_langIds, m_languageCount);
+    for (;;) {
+        WaitForSingleObject(m_hEvent, INFINITE);
+
+        EnterCriticalSection(&m_cs);
+        bool bStop = m_bStop;
+        bool bPending = m_bPending;
+        ULONGLONG qwValue = m_qwPendingValue;
+        DWORD dwSources = m_dwPendingSources;
+        DWORD dwGeneration = m_dwPendingGeneration;
+        m_bPending = false;
+        LeaveCriticalSection(&m_cs);
+        if (bStop) break;
+        if (!bPending || !isCurrent(dwGeneration)) continue; // Request is already outdated
+
+        LiveResult* pResult = (LiveResult*)InterlockedExchangePointer((PVOID volatile*)&m_pSpare, NULL);
+        if (pResult == NULL) pResult = new LiveResult;
+        TextBufferSink sink(pResult->szText, _countof(pResult->szText));
+        formatTranslation(*pEngine, qwValue, dwSources, sink);
+        pResult->length = sink.length();
+        if (!isCurrent(dwGeneration) || !PostMessage(m_hNotify, WM_APP_TRANSLATED, (WPARAM)dwGeneration, (LPARAM)pResult)) release(pResult);
+    }
+    delete pEngine;
+}
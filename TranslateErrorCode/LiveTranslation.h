@@ -0,0 +1,53 @@
+#pragma once
+
+#include "framework.h"
+#include "TranslateEngine.h"
+
+// Message posted to the notify window with a finished translation
+// wParam = Generation of the request, lParam = LiveResult* (return with LiveTranslator::release)
+#define WM_APP_TRANSLATED (WM_APP + 1)
+
+// Delay in ms after the last keystroke before a live translation starts
+#define LIVETRANSLATIONDELAY 150
+
+// Max chars for the text of a translation
+#define MAXTRANSLATIONLENGTH 16384
+
+// Result of a background translation
+struct LiveResult {
+    size_t length;
+    wchar_t szText[MAXTRANSLATIONLENGTH];
+};
+
+// Worker thread for translations. Only the newest request is processed,
+// older requests not yet started are dropped.
+class LiveTranslator {
+public:
+    LiveTranslator();
+    ~LiveTranslator();
+    bool start(HWND hNotify);
+    void stop();
+    void setLanguages(const LANGID* pLangIds, size_t count);
+    DWORD request(ULONGLONG qwValue, DWORD dwSources);
+    void release(LiveResult* pResult);
+    DWORD cancel() { return (DWORD)InterlockedIncrement(&m_lGeneration); }
+    bool isCurrent(DWORD dwGeneration) const { return (DWORD)m_lGeneration == dwGeneration; }
+private:
+    static DWORD WINAPI threadProc(LPVOID lpParameter);
+    void run();
+    HWND m_hNotify = NULL;
+    HANDLE m_hThread = NULL;
+    HANDLE m_hEvent = NULL;
+    CRITICAL_SECTION m_cs;
+    volatile LONG m_lGeneration = 0;
+    bool m_bStop = false;
+    bool m_bPending = false;
+    ULONGLONG m_qwPendingValue = 0;
+    DWORD m_dwPendingSources = 0;
+    DWORD m_dwPendingGeneration = 0;
+    LANGID m_langIds[MAXLANGUAGES];
+    size_t m_languageCount = 0;
+    LiveResult* volatile m_pSpare = NULL; // Released result, reused for the next request
+};
+
+void formatTranslation(TranslateEngine& engine, ULONGLONG qwValue, DWORD dwSources, TextBufferSink& sink);
@@ -0,0 +1,634 @@
+﻿/*+===================================================================
+  File:      LogScanner.cpp
+
+  Summary:   Log file annotator. Reads a log file (like CBS.log,
+             WindowsUpdate.log or setupapi.dev.log) or stdin, finds all
+             tokens looking like error codes (0x..., hr=..., Status=...,
+             negative decimals) and writes each line with the texts of
+             the found error codes appended.
+
+             Usage:
+             TranslateErrorCode.exe /scan [file] [/sources:wu,ntstatus,...]
+
+             The input is processed in large chunks without conversion
+             to UTF-16. Lines without error codes are written unchanged
+             directly from the input buffer.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "LogScanner.h"
+#include "BatchMode.h"
+#include "TranslateEngine.h"
+#include "CodeParser.h"
+#include <string>
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#include <intrin.h>
+#define SCAN_SSE2
+#endif
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isAlnum
+
+  Summary:  Check for ASCII letter, digit or underscore (part of a word)
+
+  Args:     char ch
+              Char
+
+  Returns:  bool
+
+-----------------------------------------------------------------F-F*/
+inline bool isAlnum(char ch) {
+    return ((ch >= '0') && (ch <= '9')) || ((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) || (ch == '_');
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getHexDigit
+
+  Summary:  Get value of a hex digit
+
+  Args:     char ch
+              Char
+
+  Returns:  int
+              0...15 or -1 for no hex digit
+
+-----------------------------------------------------------------F-F*/
+inline int getHexDigit(char ch) {
+    if ((ch >= '0') && (ch <= '9')) return ch - '0';
+    if ((ch >= 'a') && (ch <= 'f')) return ch - 'a' + 10;
+    if ((ch >= 'A') && (ch <= 'F')) return ch - 'A' + 10;
+    return -1;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseHexToken
+
+  Summary:  Parse 1...8 hex digits followed by a word boundary
+
+  Args:     const char* p
+              First digit
+            const char* pEnd
+              End of line
+            DWORD* pdwValue
+              Receives the value
+
+  Returns:  size_t
+              Number of digits, 0 = no valid token
+
+-----------------------------------------------------------------F-F*/
+size_t parseHexToken(const char* p, const char* pEnd, DWORD* pdwValue) {
+    DWORD dwValue = 0;
+    size_t digits = 0;
+    int digit;
+    while ((p + digits < pEnd) && ((digit = getHexDigit(p[digits])) >= 0)) {
+        if (++digits > 8) return 0; // No 32 bit value (e.g. an address)
+        dwValue = (dwValue << 4) | digit;
+    }
+    if ((digits == 0) || ((p + digits < pEnd) && isAlnum(p[digits]))) return 0;
+    *pdwValue = dwValue;
+    return digits;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseNumberToken
+
+  Summary:  Parse signed decimal or 0x hex number in the range of a 32 bit
+            value followed by a word boundary
+
+  Args:     const char* p
+              First char ('-' or digit)
+            const char* pEnd
+              End of line
+            DWORD* pdwValue
+              Receives the value
+            bool* pbHex
+              Receives true for a 0x hex number
+
+  Returns:  size_t
+              Number of chars, 0 = no valid token
+
+-----------------------------------------------------------------F-F*/
+size_t parseNumberToken(const char* p, const char* pEnd, DWORD* pdwValue, bool* pbHex) {
+    ParsedNumber number;
+    if (parseNumberPrefix(p, pEnd - p, &number) != PARSE_OK) return 0;
+    if ((p + number.length < pEnd) && isAlnum(p[number.length])) return 0;
+    if (!getErrorCode(number, pdwValue)) return 0; // No 32 bit value (e.g. an address)
+    *pbHex = number.bHex;
+    return number.length;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: addToken
+
+  Summary:  Add found error code, if the code is not yet in the list
+
+  Args:     ScanToken* pTokens
+              List
+            size_t& count
+              Number of tokens in the list
+            size_t maxTokens
+              Size of list
+            size_t offset
+            size_t length
+            DWORD dwCode
+              Token
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void addToken(ScanToken* pTokens, size_t& count, size_t maxTokens, size_t offset, size_t length, DWORD dwCode) {
+    if ((count >= maxTokens) || (dwCode == 0)) return; // 0 = Success, no error code
+    for (size_t i = 0; i < count; i++) {
+        if (pTokens[i].code == dwCode) return;
+    }
+    pTokens[count++] = { offset, length, dwCode };
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: checkKeywordValue
+
+  Summary:  Check for hr=value or status=value (case insensitive, spaces
+            around '=' allowed) before a '=' and parse decimal or hex (without 0x)
+            values. Values with 0x are found by the hex scan.
+
+  Args:     const char* pLine
+              Line
+            const char* pEqual
+              Position of '='
+            const char* pEnd
+              End of line
+            ScanToken* pTokens
+            size_t& count
+            size_t maxTokens
+              Found tokens
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void checkKeywordValue(const char* pLine, const char* pEqual, const char* pEnd, ScanToken* pTokens, size_t& count, size_t maxTokens) {
+    static const char* c_aszKeywords[] = { "hr", "status", "hresult", "error", "result" };
+    const char* pKeyEnd = pEqual;
+    while ((pKeyEnd > pLine) && (pKeyEnd[-1] == ' ')) pKeyEnd--;
+    const char* pKey = pKeyEnd;
+    while ((pKey > pLine) && isAlnum(pKey[-1])) pKey--;
+    size_t keyLength = pKeyEnd - pKey;
+    bool bKeyword = false;
+    for (const char* szKeyword : c_aszKeywords) {
+        if ((strlen(szKeyword) == keyLength) && (_strnicmp(pKey, szKeyword, keyLength) == 0)) bKeyword = true;
+    }
+    if (!bKeyword) return;
+
+    const char* pValue = pEqual + 1;
+    while ((pValue < pEnd) && (*pValue == ' ')) pValue++;
+    if ((pValue + 1 < pEnd) && (pValue[0] == '0') && ((pValue[1] == 'x') || (pValue[1] == 'X'))) return; // Hex scan
+    DWORD dwValue;
+    size_t length = parseHexToken(pValue, pEnd, &dwValue);
+    if (length == 8) { // hr=80070005
+        addToken(pTokens, count, maxTokens, pValue - pLine, length, dwValue);
+        return;
+    }
+    bool bHex;
+    if ((pValue < pEnd) && (length = parseNumberToken(pValue, pEnd, &dwValue, &bHex)) > 0) {
+        addToken(pTokens, count, maxTokens, pValue - pLine, length, dwValue);
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: checkCandidate
+
+  Summary:  Check token at a position found by the scan for '0', '-' or '='
+
+  Args:     const char* pLine
+              Line
+            const char* p
+              Candidate
+            const char* pEnd
+              End of line
+            ScanToken* pTokens
+            size_t& count
+            size_t maxTokens
+              Found tokens
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+inline void checkCandidate(const char* pLine, const char* p, const char* pEnd, ScanToken* pTokens, size_t& count, size_t maxTokens) {
+    DWORD dwValue;
+    size_t length;
+    bool bHex;
+    bool bBoundary = (p == pLine) || !isAlnum(p[-1]);
+    switch (*p) {
+        case '0': // 0x...
+            if (bBoundary && ((length = parseNumberToken(p, pEnd, &dwValue, &bHex)) > 0) && bHex) {
+                addToken(pTokens, count, maxTokens, p - pLine, length, dwValue);
+            }
+            break;
+        case '-': // Negative decimals with at least 5 digits (HRESULT or NTSTATUS as signed int)
+            if (bBoundary && (p + 6 <= pEnd) && ((length = parseNumberToken(p, pEnd, &dwValue, &bHex)) > 5) && !bHex) {
+                addToken(pTokens, count, maxTokens, p - pLine, length, dwValue);
+            }
+            break;
+        case '=':
+            checkKeywordValue(pLine, p, pEnd, pTokens, count, maxTokens);
+            break;
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: findErrorCodeTokens
+
+  Summary:  Find all tokens looking like error codes in a line. Candidates
+            ('0' followed by 'x', '-' and '=') are searched with SSE2
+            16 bytes at once.
+
+  Args:     const char* pLine
+              Line (UTF-8 or ANSI)
+            size_t length
+              Length of line in bytes
+            ScanToken* pTokens
+              Receives the tokens (each error code only once)
+            size_t maxTokens
+              Size of pTokens
+
+  Returns:  size_t
+              Number of tokens
+
+-----------------------------------------------------------------F-F*/
+size_t findErrorCodeTokens(const char* pLine, size_t length, ScanToken* pTokens, size_t maxTokens) {
+    const char* pEnd = pLine + length;
+    const char* p = pLine;
+    size_t count = 0;
+#ifdef SCAN_SSE2
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i x = _mm_set1_epi8('x');
+    const __m128i lowerCase = _mm_set1_epi8(0x20);
+    const __m128i minus = _mm_set1_epi8('-');
+    const __m128i equal = _mm_set1_epi8('=');
+    while (p + 17 <= pEnd) {
+        __m128i chars = _mm_loadu_si128((const __m128i*)p);
+        __m128i next = _mm_loadu_si128((const __m128i*)(p + 1));
+        __m128i hex = _mm_and_si128(_mm_cmpeq_epi8(chars, zero), _mm_cmpeq_epi8(_mm_or_si128(next, lowerCase), x));
+        __m128i candidates = _mm_or_si128(hex, _mm_or_si128(_mm_cmpeq_epi8(chars, minus), _mm_cmpeq_epi8(chars, equal)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(candidates);
+        while (mask != 0) {
+            unsigned long bit;
+            _BitScanForward(&bit, mask);
+            checkCandidate(pLine, p + bit, pEnd, pTokens, count, maxTokens);
+            mask &= mask - 1;
+        }
+        p += 16;
+    }
+#endif
+    for (; p < pEnd; p++) {
+        if (((*p == '0') && (p + 1 < pEnd) && ((p[1] | 0x20) == 'x')) || (*p == '-') || (*p == '=')) checkCandidate(pLine, p, pEnd, pTokens, count, maxTokens);
+    }
+    return count;
+}
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    ScanOutput
+
+  Summary:  Buffered byte writer. Writes UTF-8 to files and pipes and
+            converts to UTF-16 for a console.
+-----------------------------------------------------------------C-C*/
+class ScanOutput {
+public:
+    explicit ScanOutput(HANDLE hOutput);
+    ~ScanOutput() { flush(); }
+    void write(const char* p, size_t length);
+    void flush();
+    bool failed() const { return m_bFailed; }
+private:
+    void writeDirect(const char* p, size_t length);
+    HANDLE m_hOutput;
+    bool m_bConsole;
+    bool m_bFailed = false; // Output could not be written completely (e.g. disk full or pipe closed)
+    std::string m_sBuffer;
+    std::wstring m_sConsole;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ScanOutput::ScanOutput
+
+  Summary:  Constructor
+
+  Args:     HANDLE hOutput
+              Handle for output (console, file or pipe)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+ScanOutput::ScanOutput(HANDLE hOutput) : m_hOutput(hOutput) {
+    DWORD dwMode;
+    m_bConsole = (GetConsoleMode(hOutput, &dwMode) != 0);
+    m_sBuffer.reserve(BATCHBUFFERSIZE);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ScanOutput::write
+
+  Summary:  Write bytes (large blocks are written without copy)
+
+  Args:     const char* p
+              Data
+            size_t length
+              Length in bytes
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void ScanOutput::write(const char* p, size_t length) {
+    if (m_sBuffer.size() + length <= BATCHBUFFERSIZE) {
+        m_sBuffer.append(p, length);
+        return;
+    }
+    flush();
+    if (length >= BATCHBUFFERSIZE) writeDirect(p, length); else m_sBuffer.append(p, length);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ScanOutput::flush
+
+  Summary:  Write buffered data
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void ScanOutput::flush() {
+    if (m_sBuffer.empty()) return;
+    writeDirect(m_sBuffer.data(), m_sBuffer.size());
+    m_sBuffer.clear();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: ScanOutput::writeDirect
+
+  Summary:  Write data to output handle, a failed write is recorded for
+            failed()
+
+  Args:     const char* p
+              Data
+            size_t length
+              Length in bytes
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void ScanOutput::writeDirect(const char* p, size_t length) {
+    DWORD dwWritten = 0;
+    if (m_bConsole) {
+        int cch = MultiByteToWideChar(CP_UTF8, 0, p, (int)length, NULL, 0);
+        if (cch <= 0) {
+            m_bFailed = true;
+            return;
+        }
+        m_sConsole.resize(cch);
+        MultiByteToWideChar(CP_UTF8, 0, p, (int)length, &m_sConsole[0], cch);
+        if (!WriteConsole(m_hOutput, m_sConsole.data(), (DWORD)cch, &dwWritten, NULL) || (dwWritten != (DWORD)cch)) m_bFailed = true;
+    } else {
+        if (!WriteFile(m_hOutput, p, (DWORD)length, &dwWritten, NULL) || (dwWritten != (DWORD)length)) m_bFailed = true;
+    }
+}
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    LogAnnotator
+
+  Summary:  Creates annotations " [0x... Source: Text | ...]" for error
+            codes. The UTF-8 annotations are cached, because logs often
+            repeat the same codes.
+-----------------------------------------------------------------C-C*/
+class LogAnnotator {
+public:
+    explicit LogAnnotator(DWORD dwSources) : m_cache(SCANCACHESIZE) { m_engine.setSources(dwSources); }
+    const std::string& getAnnotation(DWORD dwCode);
+private:
+    struct CacheEntry {
+        bool bValid = false;
+        DWORD code = 0;
+        std::string sText; // Empty = no text for the error code
+    };
+    TranslateEngine m_engine;
+    ResultListSink m_results;
+    std::vector<CacheEntry> m_cache;
+    std::wstring m_sText;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LogAnnotator::getAnnotation
+
+  Summary:  Get annotation for an error code
+
+  Args:     DWORD dwCode
+              Error code
+
+  Returns:  const std::string&
+              UTF-8 annotation, empty if no source knows the code
+
+-----------------------------------------------------------------F-F*/
+const std::string& LogAnnotator::getAnnotation(DWORD dwCode) {
+    CacheEntry& entry = m_cache[((dwCode * 2654435761u) >> 24) & (SCANCACHESIZE - 1)];
+    if (entry.bValid && (entry.code == dwCode)) return entry.sText;
+
+    entry.bValid = true;
+    entry.code = dwCode;
+    entry.sText.clear();
+    m_results.clear();
+    if (m_engine.translate(dwCode, m_results) == 0) return entry.sText;
+
+    wchar_t szCode[20];
+    _snwprintf_s(szCode, _countof(szCode), _TRUNCATE, L" [0x%08X ", dwCode);
+    m_sText.assign(szCode);
+    for (size_t i = 0; i < m_results.count; i++) {
+        if (i > 0) m_sText.append(L" | ");
+        m_sText.append(getSourceName(m_results.results[i].source));
+        m_sText.append(L": ");
+        for (size_t j = 0; j < m_results.results[i].length; j++) { // Texts with line breaks in one line
+            wchar_t ch = m_results.results[i].szText[j];
+            if (ch == L'\r') continue;
+            m_sText.push_back((ch == L'\n') ? L' ' : ch);
+        }
+    }
+    m_sText.push_back(L']');
+
+    int cb = WideCharToMultiByte(CP_UTF8, 0, m_sText.data(), (int)m_sText.size(), NULL, 0, NULL, NULL);
+    if (cb > 0) {
+        entry.sText.resize(cb);
+        WideCharToMultiByte(CP_UTF8, 0, m_sText.data(), (int)m_sText.size(), &entry.sText[0], cb, NULL, NULL);
+    }
+    return entry.sText;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: annotateLines
+
+  Summary:  Write all complete lines of a block with annotations. Lines
+            without error codes are written unchanged in one piece.
+
+  Args:     const char* pData
+              Block
+            size_t length
+              Length of block
+            bool bFinal
+              true = Last block, the last line does not need a line break
+            LogAnnotator& annotator
+              Annotations
+            ScanOutput& output
+              Output
+
+  Returns:  size_t
+              Number of processed bytes (incomplete last line is not processed)
+
+-----------------------------------------------------------------F-F*/
+size_t annotateLines(const char* pData, size_t length, bool bFinal, LogAnnotator& annotator, ScanOutput& output) {
+    const char* pEnd = pData + length;
+    const char* pUnwritten = pData;
+    const char* pLine = pData;
+    ScanToken tokens[MAXSCANCODES];
+
+    while (pLine < pEnd) {
+        const char* pNewLine = (const char*)memchr(pLine, '\n', pEnd - pLine);
+        if ((pNewLine == NULL) && !bFinal) break; // Incomplete line
+        const char* pLineEnd = (pNewLine == NULL) ? pEnd : pNewLine;
+        if ((pLineEnd > pLine) && (pLineEnd[-1] == '\r')) pLineEnd--;
+
+        size_t count = findErrorCodeTokens(pLine, pLineEnd - pLine, tokens, MAXSCANCODES);
+        bool bAnnotated = false;
+        for (size_t i = 0; i < count; i++) {
+            const std::string& sAnnotation = annotator.getAnnotation(tokens[i].code);
+            if (sAnnotation.empty()) continue;
+            if (!bAnnotated) { // Write unchanged data up to the end of the line
+                output.write(pUnwritten, pLineEnd - pUnwritten);
+                pUnwritten = pLineEnd;
+                bAnnotated = true;
+            }
+            output.write(sAnnotation.data(), sAnnotation.size());
+        }
+        pLine = (pNewLine == NULL) ? pEnd : pNewLine + 1;
+    }
+    output.write(pUnwritten, pLine - pUnwritten);
+    return pLine - pData;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: runLogScan
+
+  Summary:  Annotate all lines of a log file or stdin
+
+  Args:     int argc
+            LPWSTR* argv
+              Command line arguments
+
+  Returns:  int
+              0 = success
+              1 = invalid arguments, input file could not be opened or
+                  output could not be written
+
+-----------------------------------------------------------------F-F*/
+int runLogScan(int argc, LPWSTR* argv) {
+    LPCWSTR szFile = NULL;
+    LPCWSTR szValue;
+    DWORD dwSources = SOURCEMASK_ALL;
+    bool bArgsOK = true;
+
+    for (int i = 1; i < argc; i++) {
+        if (isOption(argv[i], L"scan")) continue;
+        if (isOption(argv[i], L"sources", &szValue)) {
+            dwSources = parseSourceList(szValue);
+            if (dwSources == 0) bArgsOK = false;
+        } else if ((szFile == NULL) && (argv[i][0] != L'/')) {
+            szFile = argv[i];
+        } else bArgsOK = false;
+    }
+    if (!bArgsOK) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Usage: TranslateErrorCode.exe /scan [file] [/sources:wu,ntstatus,...]\n"
+            L"Writes the lines of a log file or stdin with the texts for all found error codes\n");
+        return 1;
+    }
+
+    HANDLE hInput;
+    bool bInputFile = false;
+    if ((szFile == NULL) || (wcscmp(szFile, L"-") == 0)) {
+        hInput = getBatchStdHandle(STD_INPUT_HANDLE);
+    } else {
+        hInput = CreateFile(szFile, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (hInput == INVALID_HANDLE_VALUE) {
+            BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+            error.write(L"Input file could not be opened: ");
+            error.write(szFile);
+            error.write(L"\n");
+            return 1;
+        }
+        bInputFile = true;
+    }
+
+    ScanOutput output(getBatchStdHandle(STD_OUTPUT_HANDLE));
+    LogAnnotator* pAnnotator = new LogAnnotator(dwSources); // Engine buffers are too large for the stack
+    char* pBuffer = new char[SCANBUFFERSIZE];
+    std::wstring sUTF16; // Input converted from UTF-16
+    std::string sUTF8;
+    size_t used = 0;     // Bytes in pBuffer
+    bool bStart = true;
+    bool bUTF16 = false;
+    bool bEOF = false;
+
+    while (!bEOF) {
+        DWORD dwRead = 0;
+        if (!ReadFile(hInput, pBuffer + used, (DWORD)(SCANBUFFERSIZE - used), &dwRead, NULL) || (dwRead == 0)) bEOF = true;
+        used += dwRead;
+        size_t start = 0;
+        if (bStart && (used >= 3 || bEOF)) { // Check byte order mark
+            bStart = false;
+            if ((used >= 2) && ((BYTE)pBuffer[0] == 0xFF) && ((BYTE)pBuffer[1] == 0xFE)) {
+                bUTF16 = true;
+                start = 2;
+            } else if ((used >= 3) && ((BYTE)pBuffer[0] == 0xEF) && ((BYTE)pBuffer[1] == 0xBB) && ((BYTE)pBuffer[2] == 0xBF)) {
+                start = 3;
+            }
+        } else if (bStart) continue;
+
+        const char* pData = pBuffer + start;
+        size_t length = used - start;
+        size_t processed;
+        if (bUTF16) { // Convert complete chars to UTF-8 and process all complete lines
+            size_t cch = length / sizeof(wchar_t);
+            const wchar_t* pText = (const wchar_t*)pData;
+            if (!bEOF && (cch > 0) && IS_HIGH_SURROGATE(pText[cch - 1])) cch--;
+            size_t lineEnd = cch;
+            if (!bEOF) {
+                while ((lineEnd > 0) && (pText[lineEnd - 1] != L'\n')) lineEnd--;
+                if ((lineEnd == 0) && (cch * sizeof(wchar_t) + start + 1 >= SCANBUFFERSIZE)) lineEnd = cch; // Line longer than buffer
+            }
+            int cb = (lineEnd == 0) ? 0 : WideCharToMultiByte(CP_UTF8, 0, pText, (int)lineEnd, NULL, 0, NULL, NULL);
+            sUTF8.resize(cb);
+            if (cb > 0) WideCharToMultiByte(CP_UTF8, 0, pText, (int)lineEnd, &sUTF8[0], cb, NULL, NULL);
+            annotateLines(sUTF8.data(), sUTF8.size(), true, *pAnnotator, output);
+            processed = lineEnd * sizeof(wchar_t);
+        } else {
+            processed = annotateLines(pData, length, bEOF, *pAnnotator, output);
+            if ((processed == 0) && (used == SCANBUFFERSIZE)) processed = annotateLines(pData, length, true, *pAnnotator, output); // Line longer than buffer
+        }
+
+        // Keep incomplete last line for the next block
+        used = length - processed;
+        memmove(pBuffer, pData + processed, used);
+    }
+    output.flush();
+
+    delete[] pBuffer;
+    delete pAnnotator;
+    if (bInputFile) CloseHandle(hInput);
+    if (output.failed()) {
+        BatchWriter error(getBatchStdHandle(STD_ERROR_HANDLE));
+        error.write(L"Output could not be written\n");
+        return 1;
+    }
+    return 0;
+}
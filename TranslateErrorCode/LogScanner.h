@@ -0,0 +1,22 @@
+#pragma once
+
+#include "framework.h"
+
+// Buffer size for reading the log file
+#define SCANBUFFERSIZE (1024 * 1024)
+
+// Max error codes per line
+#define MAXSCANCODES 16
+
+// Number of entries in the annotation cache (power of 2)
+#define SCANCACHESIZE 256
+
+// Error code found in a log line
+struct ScanToken {
+    size_t offset;  // Offset of the token in the line
+    size_t length;  // Length of the token
+    DWORD code;
+};
+
+size_t findErrorCodeTokens(const char* pLine, size_t length, ScanToken* pTokens, size_t maxTokens);
+int runLogScan(int argc, LPWSTR* argv);
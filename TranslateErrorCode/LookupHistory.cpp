@@ -0,0 +1,243 @@
+﻿/*+===================================================================
+  File:      LookupHistory.cpp
+
+  Summary:   History of the last translated inputs for the dialog. The
+             translations are kept in memory, so a recent input is shown
+             again without parsing or lookup. Registry writes are done on
+             a background thread and coalesced, so a translation never
+             waits for the registry (e.g. with roaming profiles).
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "LookupHistory.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::LookupHistory
+
+  Summary:  Constructor
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+LookupHistory::LookupHistory() {
+    InitializeCriticalSection(&m_cs);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::~LookupHistory
+
+  Summary:  Destructor
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+LookupHistory::~LookupHistory() {
+    stop();
+    DeleteCriticalSection(&m_cs);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::load
+
+  Summary:  Read inputs from the registry value "History" (REG_MULTI_SZ)
+            or from "LastInput" of older versions. Does nothing, when the
+            history was already loaded (dialog opened again in the
+            resident mode).
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LookupHistory::load() {
+    if (m_bLoaded) return;
+    m_bLoaded = true;
+
+    DWORD valueSize = 0;
+    if (RegGetValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"History", RRF_RT_REG_MULTI_SZ, NULL, NULL, &valueSize) == ERROR_SUCCESS) {
+        std::vector<wchar_t> value(valueSize / sizeof(wchar_t) + 2, L'\0'); // Two terminations, also for an invalid value
+        valueSize = (DWORD)((value.size() - 2) * sizeof(wchar_t));
+        if (RegGetValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"History", RRF_RT_REG_MULTI_SZ, NULL, value.data(), &valueSize) == ERROR_SUCCESS) {
+            for (const wchar_t* p = value.data(); (*p != L'\0') && (m_entries.size() < MAXHISTORYENTRIES); p += wcslen(p) + 1) {
+                m_entries.push_back({ p, std::wstring(), 0 });
+            }
+            return;
+        }
+    }
+    if (RegGetValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"LastInput", RRF_RT_REG_SZ, NULL, NULL, &valueSize) == ERROR_SUCCESS) {
+        std::vector<wchar_t> value(valueSize / sizeof(wchar_t) + 1, L'\0');
+        valueSize = (DWORD)((value.size() - 1) * sizeof(wchar_t));
+        if ((RegGetValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"LastInput", RRF_RT_REG_SZ, NULL, value.data(), &valueSize) == ERROR_SUCCESS) &&
+            (value[0] != L'\0')) m_entries.push_back({ value.data(), std::wstring(), 0 });
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::start
+
+  Summary:  Start thread for the registry writes
+
+  Args:
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool LookupHistory::start() {
+    if (m_hThread != NULL) return true;
+    m_bStop = false;
+    m_hEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (m_hEvent == NULL) return false;
+    m_hThread = CreateThread(NULL, 0, threadProc, this, 0, NULL);
+    if (m_hThread == NULL) {
+        CloseHandle(m_hEvent);
+        m_hEvent = NULL;
+        return false;
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::stop
+
+  Summary:  Write pending changes and stop the thread
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LookupHistory::stop() {
+    if (m_hThread == NULL) return;
+    EnterCriticalSection(&m_cs);
+    m_bStop = true;
+    LeaveCriticalSection(&m_cs);
+    SetEvent(m_hEvent);
+    WaitForSingleObject(m_hThread, INFINITE);
+    CloseHandle(m_hThread);
+    CloseHandle(m_hEvent);
+    m_hThread = NULL;
+    m_hEvent = NULL;
+    write(); // Changes after the thread has ended
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::add
+
+  Summary:  Add input as newest entry (an existing entry with the same
+            input is moved to the front) and schedule the registry write
+
+  Args:     const wchar_t* szInput
+              Input
+            const wchar_t* szOutput
+              Translation
+            DWORD dwSources
+              Sources of the translation (SOURCEBIT mask)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LookupHistory::add(const wchar_t* szInput, const wchar_t* szOutput, DWORD dwSources) {
+    size_t i = 0;
+    while ((i < m_entries.size()) && (m_entries[i].sInput != szInput)) i++;
+    if (i == m_entries.size()) {
+        if (m_entries.size() >= MAXHISTORYENTRIES) m_entries.pop_back();
+        m_entries.insert(m_entries.begin(), { szInput, szOutput, dwSources });
+    } else {
+        Entry entry = std::move(m_entries[i]);
+        entry.sOutput = szOutput;
+        entry.dwSources = dwSources;
+        m_entries.erase(m_entries.begin() + i);
+        m_entries.insert(m_entries.begin(), std::move(entry));
+    }
+
+    // Inputs as REG_MULTI_SZ for the thread
+    std::wstring sValue;
+    for (const Entry& entry : m_entries) {
+        sValue.append(entry.sInput);
+        sValue.push_back(L'\0');
+    }
+    sValue.push_back(L'\0');
+    EnterCriticalSection(&m_cs);
+    m_sPending.swap(sValue);
+    m_bDirty = true;
+    LeaveCriticalSection(&m_cs);
+    if (m_hEvent != NULL) SetEvent(m_hEvent);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::write
+
+  Summary:  Write pending inputs to the registry ("History" and the
+            newest input as "LastInput" for older versions)
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LookupHistory::write() {
+    std::wstring sValue;
+    EnterCriticalSection(&m_cs);
+    bool bDirty = m_bDirty;
+    if (bDirty) sValue.swap(m_sPending);
+    m_bDirty = false;
+    LeaveCriticalSection(&m_cs);
+    if (!bDirty) return;
+
+    RegSetKeyValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"History", REG_MULTI_SZ, sValue.data(), (DWORD)(sValue.size() * sizeof(wchar_t)));
+    RegSetKeyValue(HKEY_CURRENT_USER, HISTORYREGISTRYKEY, L"LastInput", REG_SZ, sValue.c_str(), (DWORD)(wcslen(sValue.c_str()) + 1) * sizeof(wchar_t));
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::threadProc
+
+  Summary:  Thread entry
+
+  Args:     LPVOID lpParameter
+              LookupHistory*
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+DWORD WINAPI LookupHistory::threadProc(LPVOID lpParameter) {
+    ((LookupHistory*)lpParameter)->run();
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: LookupHistory::run
+
+  Summary:  Write changes, when no further change follows within
+            HISTORYFLUSHDELAY, until stop() is called
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void LookupHistory::run() {
+    for (;;) {
+        WaitForSingleObject(m_hEvent, INFINITE);
+        // Wait for more changes
+        for (;;) {
+            EnterCriticalSection(&m_cs);
+            bool bStop = m_bStop;
+            LeaveCriticalSection(&m_cs);
+            if (bStop) {
+                write();
+                return;
+            }
+            if (WaitForSingleObject(m_hEvent, HISTORYFLUSHDELAY) == WAIT_TIMEOUT) break;
+        }
+        write();
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "framework.h"
+#include <string>
+#include <vector>
+
+// Max number of entries in the history
+#define MAXHISTORYENTRIES 16
+
+// Delay in ms after the last change before the history is written to the registry
+#define HISTORYFLUSHDELAY 2000
+
+// Registry key for the history
+#define HISTORYREGISTRYKEY L"Software\\CodingABI\\TranslateErrorCode"
+
+// Most recently used inputs with their translations. The inputs are
+// written to the registry by a background thread, several changes within
+// HISTORYFLUSHDELAY are written at once. Methods must be called from one
+// thread only (the dialog), only the writing runs on the background thread.
+class LookupHistory {
+public:
+    LookupHistory();
+    ~LookupHistory();
+    void load();
+    bool start();
+    void stop();
+    void add(const wchar_t* szInput, const wchar_t* szOutput, DWORD dwSources);
+    size_t size() const { return m_entries.size(); }
+    const std::wstring& input(size_t index) const { return m_entries[index].sInput; }
+    const std::wstring& output(size_t index) const { return m_entries[index].sOutput; }
+    DWORD sources(size_t index) const { return m_entries[index].dwSources; }
+private:
+    struct Entry {
+        std::wstring sInput;
+        std::wstring sOutput; // Empty = Not yet translated (entry from the registry)
+        DWORD dwSources;      // Source mask of sOutput
+    };
+    static DWORD WINAPI threadProc(LPVOID lpParameter);
+    void run();
+    void write();
+    std::vector<Entry> m_entries;    // Newest first
+    bool m_bLoaded = false;
+    HANDLE m_hThread = NULL;
+    HANDLE m_hEvent = NULL;
+    CRITICAL_SECTION m_cs;
+    std::wstring m_sPending;         // Inputs as REG_MULTI_SZ, protected by m_cs
+    bool m_bDirty = false;           // Protected by m_cs
+    bool m_bStop = false;            // Protected by m_cs
+};
@@ -0,0 +1,245 @@
+﻿/*+===================================================================
+  File:      MessageSnapshot.cpp
+
+  Summary:   Snapshot of all Win32/HRESULT and NTSTATUS messages. The IDs
+             are enumerated from the RT_MESSAGETABLE resources of the system
+             message DLLs and ntdll.dll, the texts come from FormatMessage,
+             so they are identical to the texts of a live lookup.
+
+             When a valid snapshot for the current UI language exists, the
+             engine uses it instead of calling FormatMessage for each code.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "MessageSnapshot.h"
+#include "TranslateEngine.h"
+#include <algorithm>
+#include <vector>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getMessageTableIds
+
+  Summary:  Get all message IDs from the message table of a module
+
+  Args:     HMODULE hModule
+              Module
+            std::vector<DWORD>& vIds
+              Receives the IDs (appended)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void getMessageTableIds(HMODULE hModule, std::vector<DWORD>& vIds) {
+    if (hModule == NULL) return;
+    HRSRC hResource = FindResourceEx(hModule, RT_MESSAGETABLE, MAKEINTRESOURCE(1), MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL));
+    if (hResource == NULL) return;
+    HGLOBAL hData = LoadResource(hModule, hResource);
+    if (hData == NULL) return;
+    const MESSAGE_RESOURCE_DATA* pData = (const MESSAGE_RESOURCE_DATA*)LockResource(hData);
+    DWORD dwSize = SizeofResource(hModule, hResource);
+    if ((pData == NULL) || (dwSize < sizeof(DWORD))) return;
+
+    for (DWORD i = 0; i < pData->NumberOfBlocks; i++) {
+        if (sizeof(DWORD) + (i + 1) * sizeof(MESSAGE_RESOURCE_BLOCK) > dwSize) break; // Damaged resource
+        const MESSAGE_RESOURCE_BLOCK& block = pData->Blocks[i];
+        for (DWORD dwId = block.LowId; dwId <= block.HighId; dwId++) {
+            vIds.push_back(dwId);
+            if (dwId == 0xFFFFFFFF) break;
+        }
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getMessageIds
+
+  Summary:  Get the IDs of all Win32/HRESULT or NTSTATUS messages from the
+            message tables
+
+  Args:     ErrorSource source
+              SOURCE_WIN32 or SOURCE_NTSTATUS
+            std::vector<DWORD>& vIds
+              Receives the IDs, sorted and deduplicated
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void getMessageIds(ErrorSource source, std::vector<DWORD>& vIds) {
+    vIds.clear();
+    if (source == SOURCE_WIN32) {
+        // System messages (kernel32.dll before Windows 7, kernelbase.dll since Windows 7)
+        getMessageTableIds(GetModuleHandle(L"kernelbase.dll"), vIds);
+        getMessageTableIds(GetModuleHandle(L"kernel32.dll"), vIds);
+        // HRESULTs from Win32 codes which are resolved by FormatMessage without an own table entry
+        size_t count = vIds.size();
+        for (size_t i = 0; i < count; i++) {
+            if (vIds[i] <= 0xFFFF) vIds.push_back(0x80070000 | vIds[i]);
+        }
+    } else getMessageTableIds(GetModuleHandle(L"ntdll.dll"), vIds);
+    std::sort(vIds.begin(), vIds.end());
+    vIds.erase(std::unique(vIds.begin(), vIds.end()), vIds.end());
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: formatSystemMessage
+
+  Summary:  Get Win32/HRESULT or NTSTATUS message from FormatMessage in
+            the default language, as it is stored in the snapshot
+
+  Args:     ErrorSource source
+              SOURCE_WIN32 or SOURCE_NTSTATUS
+            DWORD dwId
+              Message ID
+            wchar_t* pBuffer
+              Buffer with MESSAGEBUFFERSIZE chars
+
+  Returns:  size_t
+              Length of the message, 0 = no message
+
+-----------------------------------------------------------------F-F*/
+size_t formatSystemMessage(ErrorSource source, DWORD dwId, wchar_t* pBuffer) {
+    if (source == SOURCE_WIN32) return formatMessageText(FORMAT_MESSAGE_FROM_SYSTEM, NULL, dwId, DEFAULTLANGID, pBuffer);
+    return formatMessageText(FORMAT_MESSAGE_FROM_HMODULE, GetModuleHandle(L"ntdll.dll"), dwId, DEFAULTLANGID, pBuffer);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: addMessages
+
+  Summary:  Add messages for all IDs to the snapshot
+
+  Args:     CodeDatabaseWriter& writer
+              Snapshot
+            ErrorSource source
+              SOURCE_WIN32 or SOURCE_NTSTATUS
+            const std::vector<DWORD>& vIds
+              Sorted IDs
+            wchar_t* pBuffer
+              Buffer with MESSAGEBUFFERSIZE chars
+
+  Returns:  DWORD
+              Number of messages
+
+-----------------------------------------------------------------F-F*/
+DWORD addMessages(CodeDatabaseWriter& writer, ErrorSource source, const std::vector<DWORD>& vIds, wchar_t* pBuffer) {
+    DWORD dwCount = 0;
+    for (DWORD dwId : vIds) {
+        size_t length = formatSystemMessage(source, dwId, pBuffer);
+        if (length == 0) continue;
+        writer.add(source, dwId, pBuffer, length);
+        dwCount++;
+    }
+    return dwCount;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getDefaultSnapshotPath
+
+  Summary:  Get path of the snapshot in the local application data folder
+
+  Args:     wchar_t* szPath
+              Receives the path
+            size_t size
+              Size of szPath in chars
+            bool bCreateDirectory
+              true = Create the folder, if it does not exist
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool getDefaultSnapshotPath(wchar_t* szPath, size_t size, bool bCreateDirectory) {
+    DWORD dwLength = ExpandEnvironmentStrings(L"%LOCALAPPDATA%\\CodingABI", szPath, (DWORD)size);
+    if ((dwLength == 0) || (dwLength > size) || (szPath[0] == L'%')) return false;
+    if (bCreateDirectory) CreateDirectory(szPath, NULL);
+    if (wcscat_s(szPath, size, L"\\TranslateErrorCode") != 0) return false;
+    if (bCreateDirectory) CreateDirectory(szPath, NULL);
+    return (wcscat_s(szPath, size, L"\\" MESSAGESNAPSHOTFILE) == 0);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: buildMessageSnapshot
+
+  Summary:  Create snapshot with all Win32/HRESULT and NTSTATUS messages
+            for the current UI language
+
+  Args:     const wchar_t* szFile
+              Snapshot file
+            DWORD* pdwWin32Count
+              Receives the number of Win32/HRESULT messages
+            DWORD* pdwNTStatusCount
+              Receives the number of NTSTATUS messages
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool buildMessageSnapshot(const wchar_t* szFile, DWORD* pdwWin32Count, DWORD* pdwNTStatusCount) {
+    CodeDatabaseWriter writer;
+    std::vector<DWORD> vIds;
+    wchar_t* pBuffer = new wchar_t[MESSAGEBUFFERSIZE];
+
+    getMessageIds(SOURCE_WIN32, vIds);
+    *pdwWin32Count = addMessages(writer, SOURCE_WIN32, vIds, pBuffer);
+    getMessageIds(SOURCE_NTSTATUS, vIds);
+    *pdwNTStatusCount = addMessages(writer, SOURCE_NTSTATUS, vIds, pBuffer);
+
+    delete[] pBuffer;
+    return writer.write(szFile, GetUserDefaultUILanguage());
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: isSnapshotCurrent
+
+  Summary:  Check, if the snapshot is newer than the system message DLLs
+            (an older snapshot could miss messages from Windows updates)
+
+  Args:     const wchar_t* szFile
+              Snapshot file
+
+  Returns:  bool
+
+-----------------------------------------------------------------F-F*/
+bool isSnapshotCurrent(const wchar_t* szFile) {
+    static const wchar_t* c_aszModules[] = { L"\\kernelbase.dll", L"\\kernel32.dll", L"\\ntdll.dll" };
+    WIN32_FILE_ATTRIBUTE_DATA snapshot, module;
+    wchar_t szModule[MAX_PATH];
+
+    if (!GetFileAttributesEx(szFile, GetFileExInfoStandard, &snapshot)) return false;
+    for (const wchar_t* szName : c_aszModules) {
+        UINT length = GetSystemDirectory(szModule, MAX_PATH);
+        if ((length == 0) || (length >= MAX_PATH) || (wcscat_s(szModule, MAX_PATH, szName) != 0)) return false;
+        if (GetFileAttributesEx(szModule, GetFileExInfoStandard, &module) &&
+            (CompareFileTime(&snapshot.ftLastWriteTime, &module.ftLastWriteTime) < 0)) return false;
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getMessageSnapshot
+
+  Summary:  Get snapshot from the default path. The snapshot is opened
+            on the first call and shared by all engines.
+
+  Args:
+
+  Returns:  const CodeDatabase*
+              Snapshot or NULL, if no current snapshot for the UI language exists
+
+-----------------------------------------------------------------F-F*/
+const CodeDatabase* getMessageSnapshot() {
+    static CodeDatabase* s_pSnapshot = []() -> CodeDatabase* {
+        wchar_t szFile[MAX_PATH];
+        if (!getDefaultSnapshotPath(szFile, MAX_PATH, false) || !isSnapshotCurrent(szFile)) return NULL;
+        CodeDatabase* pSnapshot = new CodeDatabase(); // Never released, mapping is used until the program ends
+        if (!pSnapshot->open(szFile) || (pSnapshot->langId() != GetUserDefaultUILanguage()) ||
+            !pSnapshot->hasSource(SOURCE_WIN32) || !pSnapshot->hasSource(SOURCE_NTSTATUS)) {
+            delete pSnapshot;
+            return NULL;
+        }
+        return pSnapshot;
+    }();
+    return s_pSnapshot;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "framework.h"
+#include "CodeDatabase.h"
+#include <vector>
+
+// File name of the message snapshot in %LOCALAPPDATA%\CodingABI\TranslateErrorCode
+#define MESSAGESNAPSHOTFILE L"MessageSnapshot.tecdb"
+
+bool getDefaultSnapshotPath(wchar_t* szPath, size_t size, bool bCreateDirectory);
+void getMessageIds(ErrorSource source, std::vector<DWORD>& vIds);
+size_t formatSystemMessage(ErrorSource source, DWORD dwId, wchar_t* pBuffer);
+bool buildMessageSnapshot(const wchar_t* szFile, DWORD* pdwWin32Count, DWORD* pdwNTStatusCount);
+const CodeDatabase* getMessageSnapshot();
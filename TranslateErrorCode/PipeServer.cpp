@@ -0,0 +1,343 @@
+﻿/*+===================================================================
+  File:      PipeServer.cpp
+
+  Summary:   Named pipe server for the resident mode. Clients send a
+             PipeRequest message with an error code and get a message
+             with the texts of all sources.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "PipeServer.h"
+#include "WorkStealingPool.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: buildPipeResponse
+
+  Summary:  Create response message for the results of a translation
+
+  Args:     DWORD dwCode
+              Error code of the request
+            const ResultListSink& results
+              Results of the translation
+            std::vector<BYTE>& response
+              Buffer for the message
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void buildPipeResponse(DWORD dwCode, const ResultListSink& results, std::vector<BYTE>& response) {
+    size_t size = sizeof(PipeResponseHeader);
+    for (size_t i = 0; i < results.count; i++) {
+        size_t length = (results.results[i].length > MAXWORD) ? MAXWORD : results.results[i].length;
+        size += sizeof(PipeResultHeader) + length * sizeof(wchar_t);
+    }
+    response.resize(size); // Keeps the capacity, so no allocation after the first requests
+
+    BYTE* pPos = response.data();
+    PipeResponseHeader header = { PIPERESPONSEMAGIC, dwCode, (DWORD)results.count };
+    memcpy(pPos, &header, sizeof(header));
+    pPos += sizeof(header);
+    for (size_t i = 0; i < results.count; i++) {
+        const SourceResult& result = results.results[i];
+        PipeResultHeader resultHeader = { (WORD)result.source, (WORD)((result.length > MAXWORD) ? MAXWORD : result.length) };
+        memcpy(pPos, &resultHeader, sizeof(resultHeader));
+        pPos += sizeof(resultHeader);
+        memcpy(pPos, result.szText, resultHeader.length * sizeof(wchar_t));
+        pPos += resultHeader.length * sizeof(wchar_t);
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::start
+
+  Summary:  Create pipe instances and start worker threads
+
+  Args:     size_t threads
+              Number of threads (1 ... MAXWORKERTHREADS)
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT), a request can
+              only select a part of them
+
+  Returns:  bool
+              true = success
+              false = error or pipe is already used by another server
+
+-----------------------------------------------------------------F-F*/
+bool PipeServer::start(size_t threads, DWORD dwSources) {
+    if ((m_hPort != NULL) || (threads == 0) || (threads > MAXWORKERTHREADS)) return false;
+    m_dwSources = dwSources & SOURCEMASK_ALL;
+    m_hPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, (DWORD)threads);
+    if (m_hPort == NULL) return false;
+    m_lStop = 0;
+    m_lListening = 0;
+    m_lPending = 0;
+
+    // The first instance fails, when another server already owns the pipe
+    if (!addConnection(true)) {
+        stop();
+        return false;
+    }
+    // One waiting instance per thread, more are added on demand
+    for (size_t i = 1; i < threads; i++) addConnection(false);
+
+    for (size_t i = 0; i < threads; i++) {
+        HANDLE hThread = CreateThread(NULL, 0, threadProc, this, 0, NULL);
+        if (hThread == NULL) {
+            stop();
+            return false;
+        }
+        m_threads.push_back(hThread);
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::stop
+
+  Summary:  Stop worker threads and close all pipe instances
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void PipeServer::stop() {
+    if (m_hPort == NULL) return;
+    InterlockedExchange(&m_lStop, 1);
+    for (size_t i = 0; i < m_threads.size(); i++) PostQueuedCompletionStatus(m_hPort, 0, 0, NULL); // Wake up all workers
+    for (HANDLE hThread : m_threads) {
+        WaitForSingleObject(hThread, INFINITE);
+        CloseHandle(hThread);
+    }
+    m_threads.clear();
+
+    // Closing the pipes cancels the waiting operations. Their completion
+    // packets must be dequeued, before the OVERLAPPED structures are released.
+    for (Connection* pConnection : m_connections) CloseHandle(pConnection->hPipe);
+    bool bDrained = true;
+    while (m_lPending > 0) {
+        DWORD dwBytes = 0;
+        ULONG_PTR key = 0;
+        LPOVERLAPPED pOverlapped = NULL;
+        GetQueuedCompletionStatus(m_hPort, &dwBytes, &key, &pOverlapped, PIPESTOPTIMEOUT);
+        if (pOverlapped == NULL) { // Timeout, keep the memory, because the system can still write to it
+            bDrained = false;
+            break;
+        }
+        InterlockedDecrement(&m_lPending);
+    }
+    if (bDrained) {
+        for (Connection* pConnection : m_connections) delete pConnection;
+    }
+    m_connections.clear();
+    CloseHandle(m_hPort);
+    m_hPort = NULL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::addConnection
+
+  Summary:  Create a new pipe instance and wait for a client. The pipe has
+            the default security (write access only for the user, system
+            and administrators) and rejects remote clients.
+
+  Args:     bool bFirst
+              true = Fail, if the pipe already exists
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool PipeServer::addConnection(bool bFirst) {
+    if (m_lStop != 0) return false;
+    AcquireSRWLockExclusive(&m_lock);
+    if (m_connections.size() >= MAXPIPEINSTANCES) {
+        ReleaseSRWLockExclusive(&m_lock);
+        return false;
+    }
+    HANDLE hPipe = CreateNamedPipe(PIPENAME,
+        PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED | (bFirst ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+        PIPE_TYPE_MESSAGE | PIPE_READMODE_MESSAGE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+        PIPE_UNLIMITED_INSTANCES, PIPEBUFFERSIZE, PIPEBUFFERSIZE, 0, NULL);
+    if (hPipe == INVALID_HANDLE_VALUE) {
+        ReleaseSRWLockExclusive(&m_lock);
+        return false;
+    }
+    if (CreateIoCompletionPort(hPipe, m_hPort, 0, 0) == NULL) {
+        CloseHandle(hPipe);
+        ReleaseSRWLockExclusive(&m_lock);
+        return false;
+    }
+    Connection* pConnection = new Connection();
+    pConnection->hPipe = hPipe;
+    m_connections.push_back(pConnection);
+    ReleaseSRWLockExclusive(&m_lock);
+    return listen(pConnection);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::listen
+
+  Summary:  Wait for the next client on a pipe instance
+
+  Args:     Connection* pConnection
+              Unconnected pipe instance
+
+  Returns:  bool
+              true = A completion packet will follow
+
+-----------------------------------------------------------------F-F*/
+bool PipeServer::listen(Connection* pConnection) {
+    if (m_lStop != 0) return false;
+    pConnection->state = PIPE_CONNECTING;
+    ZeroMemory(&pConnection->overlapped, sizeof(pConnection->overlapped));
+    InterlockedIncrement(&m_lListening);
+    InterlockedIncrement(&m_lPending);
+    if (ConnectNamedPipe(pConnection->hPipe, &pConnection->overlapped)) return true;
+    DWORD dwError = GetLastError();
+    if (dwError == ERROR_IO_PENDING) return true;
+    // Client has connected before ConnectNamedPipe, the system sends no completion packet
+    if ((dwError == ERROR_PIPE_CONNECTED) && PostQueuedCompletionStatus(m_hPort, 0, 0, &pConnection->overlapped)) return true;
+    InterlockedDecrement(&m_lPending);
+    InterlockedDecrement(&m_lListening);
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::read
+
+  Summary:  Read the next request from a client
+
+  Args:     Connection* pConnection
+              Connected pipe instance
+
+  Returns:  bool
+              true = A completion packet will follow
+
+-----------------------------------------------------------------F-F*/
+bool PipeServer::read(Connection* pConnection) {
+    pConnection->state = PIPE_READING;
+    ZeroMemory(&pConnection->overlapped, sizeof(pConnection->overlapped));
+    InterlockedIncrement(&m_lPending);
+    if (ReadFile(pConnection->hPipe, &pConnection->request, sizeof(pConnection->request), NULL, &pConnection->overlapped)) return true;
+    DWORD dwError = GetLastError();
+    // ERROR_MORE_DATA (message is longer than a request) is a warning with a completion packet
+    if ((dwError == ERROR_IO_PENDING) || (dwError == ERROR_MORE_DATA)) return true;
+    InterlockedDecrement(&m_lPending);
+    reconnect(pConnection);
+    return false;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::reconnect
+
+  Summary:  Disconnect the client and wait for the next client
+
+  Args:     Connection* pConnection
+              Pipe instance
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void PipeServer::reconnect(Connection* pConnection) {
+    DisconnectNamedPipe(pConnection->hPipe);
+    listen(pConnection);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::complete
+
+  Summary:  Continue with the next step of a connection after its last
+            operation has completed
+
+  Args:     Connection* pConnection
+              Pipe instance
+            BOOL bSuccess
+              Result of the operation
+            DWORD dwBytes
+              Transferred bytes
+            TranslateEngine& engine
+              Engine of the worker thread
+            ResultListSink& results
+              Result buffer of the worker thread
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void PipeServer::complete(Connection* pConnection, BOOL bSuccess, DWORD dwBytes, TranslateEngine& engine, ResultListSink& results) {
+    if (m_lStop != 0) return;
+    switch (pConnection->state) {
+        case PIPE_CONNECTING:
+            // Keep at least one instance waiting for the next client
+            if (InterlockedDecrement(&m_lListening) == 0) addConnection(false);
+            if (bSuccess) read(pConnection); else reconnect(pConnection);
+            break;
+        case PIPE_READING:
+            if (!bSuccess || ((dwBytes != sizeof(PipeRequest)) && (dwBytes != PIPEREQUESTMINSIZE)) || (pConnection->request.magic != PIPEREQUESTMAGIC)) {
+                reconnect(pConnection); // Client has closed the pipe or sent an invalid message
+                break;
+            }
+            results.clear();
+            if (dwBytes == sizeof(PipeRequest)) engine.translate(pConnection->request.code, results, pConnection->request.sources & engine.sources());
+            else engine.translate(pConnection->request.code, results);
+            buildPipeResponse(pConnection->request.code, results, pConnection->response);
+            pConnection->state = PIPE_WRITING;
+            ZeroMemory(&pConnection->overlapped, sizeof(pConnection->overlapped));
+            InterlockedIncrement(&m_lPending);
+            if (!WriteFile(pConnection->hPipe, pConnection->response.data(), (DWORD)pConnection->response.size(), NULL, &pConnection->overlapped)
+                && (GetLastError() != ERROR_IO_PENDING)) {
+                InterlockedDecrement(&m_lPending);
+                reconnect(pConnection);
+            }
+            break;
+        case PIPE_WRITING:
+            if (bSuccess) read(pConnection); else reconnect(pConnection);
+            break;
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::threadProc
+
+  Summary:  Worker thread entry
+
+  Args:     LPVOID lpParameter
+              PipeServer*
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+DWORD WINAPI PipeServer::threadProc(LPVOID lpParameter) {
+    ((PipeServer*)lpParameter)->run();
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: PipeServer::run
+
+  Summary:  Process completion packets until the server is stopped
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void PipeServer::run() {
+    TranslateEngine* pEngine = new TranslateEngine(); // Not on the stack, because of the large buffers
+    pEngine->setSources(m_dwSources);
+    ResultListSink results;
+    for (;;) {
+        DWORD dwBytes = 0;
+        ULONG_PTR key = 0;
+        LPOVERLAPPED pOverlapped = NULL;
+        BOOL bSuccess = GetQueuedCompletionStatus(m_hPort, &dwBytes, &key, &pOverlapped, INFINITE);
+        if (pOverlapped == NULL) break; // Stop request
+        InterlockedDecrement(&m_lPending);
+        complete(CONTAINING_RECORD(pOverlapped, Connection, overlapped), bSuccess, dwBytes, *pEngine, results);
+    }
+    delete pEngine;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "framework.h"
+#include "TranslateEngine.h"
+#include <vector>
+#include <stddef.h>
+
+// Name of the pipe for the lookup service
+#define PIPENAME L"\\\\.\\pipe\\TranslateErrorCode"
+
+// Magic numbers of requests ("TECQ") and responses ("TECR")
+#define PIPEREQUESTMAGIC 0x51434554
+#define PIPERESPONSEMAGIC 0x52434554
+
+// Max number of pipe instances (= concurrent clients)
+#define MAXPIPEINSTANCES 256
+
+// Size of the in and out buffers of each pipe instance
+#define PIPEBUFFERSIZE 4096
+
+// Max ms to wait for cancelled pipe operations when the server is stopped
+#define PIPESTOPTIMEOUT 5000
+
+// Request message: Translate one error code. The source mask is optional,
+// requests without it (PIPEREQUESTMINSIZE bytes) search all sources of the server.
+#pragma pack(push, 1)
+struct PipeRequest {
+    DWORD magic;   // PIPEREQUESTMAGIC
+    DWORD code;    // Error code
+    DWORD sources; // Mask of the sources to search (bit 0 = ErrorSource 0, ...)
+};
+
+// Response message: PipeResponseHeader, followed by count times a
+// PipeResultHeader with length UTF-16 chars (without termination)
+struct PipeResponseHeader {
+    DWORD magic;   // PIPERESPONSEMAGIC
+    DWORD code;    // Error code of the request
+    DWORD count;   // Number of results
+};
+
+struct PipeResultHeader {
+    WORD source;   // ErrorSource
+    WORD length;   // Chars of the text
+};
+#pragma pack(pop)
+
+// Size of a request without source mask
+#define PIPEREQUESTMINSIZE offsetof(PipeRequest, sources)
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    PipeServer
+
+  Summary:  Named pipe server for the translation of error codes. All pipe
+            instances use overlapped I/O on one completion port, each
+            worker thread translates with its own engine.
+-----------------------------------------------------------------C-C*/
+class PipeServer {
+public:
+    PipeServer() {}
+    ~PipeServer() { stop(); }
+    PipeServer(const PipeServer&) = delete;
+    PipeServer& operator=(const PipeServer&) = delete;
+    bool start(size_t threads, DWORD dwSources = SOURCEMASK_ALL);
+    void stop();
+private:
+    enum ConnectionState { PIPE_CONNECTING, PIPE_READING, PIPE_WRITING };
+    struct Connection {
+        OVERLAPPED overlapped; // First member, the completion packets return its address
+        HANDLE hPipe;
+        ConnectionState state;
+        PipeRequest request;
+        std::vector<BYTE> response;
+    };
+    static DWORD WINAPI threadProc(LPVOID lpParameter);
+    void run();
+    bool addConnection(bool bFirst);
+    bool listen(Connection* pConnection);
+    bool read(Connection* pConnection);
+    void reconnect(Connection* pConnection);
+    void complete(Connection* pConnection, BOOL bSuccess, DWORD dwBytes, TranslateEngine& engine, ResultListSink& results);
+    HANDLE m_hPort = NULL;
+    DWORD m_dwSources = SOURCEMASK_ALL;     // Sources searched by the workers
+    std::vector<HANDLE> m_threads;
+    std::vector<Connection*> m_connections; // Protected by m_lock
+    SRWLOCK m_lock = SRWLOCK_INIT;
+    volatile LONG m_lListening = 0;         // Instances waiting for a client
+    volatile LONG m_lPending = 0;           // Operations with a completion packet to come
+    volatile LONG m_lStop = 0;
+};
@@ -0,0 +1,263 @@
+﻿/*+===================================================================
+  File:      SearchIndex.cpp
+
+  Summary:   Reverse lookup of error codes by symbolic name or by a part
+             of the text. The index contains the WU, LDAP, StopCode/BugCheck
+             and Wininet codes (code database or built-in tables) and the
+             Win32/HRESULT and NTSTATUS messages from the message snapshot.
+             It is built on the first search.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "SearchIndex.h"
+#include "CodeDatabase.h"
+#include "MessageSnapshot.h"
+#include <algorithm>
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: foldSearchText
+
+  Summary:  Convert text to lower case for case insensitive search
+
+  Args:     const wchar_t* pText
+              Text
+            size_t length
+              Length of text in chars
+            wchar_t* pFolded
+              Receives the lower case text (length chars, no termination)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void foldSearchText(const wchar_t* pText, size_t length, wchar_t* pFolded) {
+    wmemcpy(pFolded, pText, length);
+    if (length > 0) CharLowerBuff(pFolded, (DWORD)length);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getTrigram
+
+  Summary:  Get key for three chars
+
+  Args:     const wchar_t* p
+              First char
+
+  Returns:  ULONGLONG
+
+-----------------------------------------------------------------F-F*/
+inline ULONGLONG getTrigram(const wchar_t* p) {
+    return ((ULONGLONG)(WORD)p[0] << 32) | ((ULONGLONG)(WORD)p[1] << 16) | (WORD)p[2];
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: SearchIndex::SearchIndex
+
+  Summary:  Constructor, builds the index
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+SearchIndex::SearchIndex() {
+    const CodeDatabase* pSnapshot = getMessageSnapshot();
+    const CodeDatabase* pDatabase = getCodeDatabase();
+    const ErrorCodeTable* aTables[SOURCE_COUNT] = { NULL, NULL, &g_tblWU, &g_tblLDAP, &g_tblBugCheck, &g_tblWininet };
+    const wchar_t* szText;
+    size_t length;
+
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+        ErrorSource source = (ErrorSource)i;
+        const CodeDatabase* pSource = (aTables[i] == NULL) ? pSnapshot : pDatabase;
+        if ((pSource != NULL) && pSource->hasSource(source)) {
+            for (size_t j = 0; j < pSource->getCount(source); j++) {
+                DWORD dwCode = pSource->getEntry(source, j, &szText, &length);
+                add(source, dwCode, szText, length);
+            }
+        } else if (aTables[i] != NULL) {
+            for (size_t j = 0; j < aTables[i]->count; j++) {
+                add(source, aTables[i]->pEntries[j].code, aTables[i]->pEntries[j].text.data(), aTables[i]->pEntries[j].text.size());
+            }
+        }
+    }
+    buildNames();
+    buildTrigrams();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: SearchIndex::add
+
+  Summary:  Add error code to the index
+
+  Args:     ErrorSource source
+              Source
+            DWORD dwCode
+              Error code
+            const wchar_t* szText
+              Zero terminated text, must be valid until the program ends
+            size_t length
+              Length of text
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void SearchIndex::add(ErrorSource source, DWORD dwCode, const wchar_t* szText, size_t length) {
+    Entry entry;
+    entry.hit = { source, dwCode, szText, length };
+    entry.foldedOffset = (DWORD)m_folded.size();
+
+    // Symbolic name, like WU_E_PT_HTTP_STATUS_BAD_GATEWAY, at the begin of the text
+    size_t nameLength = 0;
+    while ((nameLength < length) && (((szText[nameLength] >= L'A') && (szText[nameLength] <= L'Z')) ||
+        ((szText[nameLength] >= L'0') && (szText[nameLength] <= L'9')) || (szText[nameLength] == L'_'))) nameLength++;
+    if ((nameLength < length) && (szText[nameLength] != L'\r')) nameLength = 0; // Normal text starting with upper case chars
+    entry.nameLength = (DWORD)nameLength;
+
+    m_folded.resize(m_folded.size() + length + 1);
+    foldSearchText(szText, length, m_folded.data() + entry.foldedOffset);
+    m_folded.back() = L'\0';
+    m_entries.push_back(entry);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: SearchIndex::buildNames
+
+  Summary:  Create table with all entries with a symbolic name, sorted by name
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void SearchIndex::buildNames() {
+    for (DWORD i = 0; i < (DWORD)m_entries.size(); i++) {
+        if (m_entries[i].nameLength > 0) m_names.push_back(i);
+    }
+    std::sort(m_names.begin(), m_names.end(), [this](DWORD a, DWORD b) {
+        int iResult = wcsncmp(getFolded(a), getFolded(b), std::min(m_entries[a].nameLength, m_entries[b].nameLength));
+        if (iResult != 0) return iResult < 0;
+        if (m_entries[a].nameLength != m_entries[b].nameLength) return m_entries[a].nameLength < m_entries[b].nameLength;
+        return a < b;
+    });
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: SearchIndex::buildTrigrams
+
+  Summary:  Create posting lists with the entries for each trigram of the texts
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void SearchIndex::buildTrigrams() {
+    std::vector<std::pair<ULONGLONG, DWORD>> vPairs;
+    std::vector<ULONGLONG> vEntryTrigrams;
+    vPairs.reserve(m_folded.size());
+    for (DWORD i = 0; i < (DWORD)m_entries.size(); i++) {
+        const wchar_t* pFolded = getFolded(i);
+        size_t length = m_entries[i].hit.length;
+        vEntryTrigrams.clear();
+        for (size_t j = 0; j + SEARCHTRIGRAMLENGTH <= length; j++) vEntryTrigrams.push_back(getTrigram(pFolded + j));
+        std::sort(vEntryTrigrams.begin(), vEntryTrigrams.end());
+        vEntryTrigrams.erase(std::unique(vEntryTrigrams.begin(), vEntryTrigrams.end()), vEntryTrigrams.end());
+        for (ULONGLONG trigram : vEntryTrigrams) vPairs.push_back({ trigram, i });
+    }
+    std::sort(vPairs.begin(), vPairs.end());
+
+    m_postings.reserve(vPairs.size());
+    for (size_t i = 0; i < vPairs.size(); i++) {
+        if ((i == 0) || (vPairs[i].first != vPairs[i - 1].first)) {
+            m_trigrams.push_back(vPairs[i].first);
+            m_postingStart.push_back((DWORD)m_postings.size());
+        }
+        m_postings.push_back(vPairs[i].second);
+    }
+    m_postingStart.push_back((DWORD)m_postings.size());
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: SearchIndex::search
+
+  Summary:  Search error codes by symbolic name or text (case insensitive).
+            Entries whose name starts with the query come first, then
+            entries containing the query in the text.
+
+  Args:     const wchar_t* szQuery
+              Query
+            SearchHit* pHits
+              Receives the results
+            size_t maxHits
+              Max number of results
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT)
+
+  Returns:  size_t
+              Number of results
+
+-----------------------------------------------------------------F-F*/
+size_t SearchIndex::search(const wchar_t* szQuery, SearchHit* pHits, size_t maxHits, DWORD dwSources) const {
+    wchar_t szFolded[MAXSEARCHQUERYLENGTH + 1];
+    size_t length = wcslen(szQuery);
+    if ((length == 0) || (length > MAXSEARCHQUERYLENGTH)) return 0;
+    foldSearchText(szQuery, length, szFolded);
+    szFolded[length] = L'\0';
+    size_t count = 0;
+
+    // Prefix search for symbolic names
+    std::vector<DWORD>::const_iterator itName = std::lower_bound(m_names.begin(), m_names.end(), szFolded, [this, length](DWORD index, const wchar_t* szKey) {
+        return wcsncmp(getFolded(index), szKey, std::min((size_t)m_entries[index].nameLength, length)) < 0 ||
+            ((m_entries[index].nameLength < length) && (wcsncmp(getFolded(index), szKey, m_entries[index].nameLength) == 0));
+    });
+    for (; (itName != m_names.end()) && (count < maxHits); itName++) {
+        if ((m_entries[*itName].nameLength < length) || (wcsncmp(getFolded(*itName), szFolded, length) != 0)) break;
+        if ((dwSources & SOURCEBIT(m_entries[*itName].hit.source)) == 0) continue;
+        pHits[count++] = m_entries[*itName].hit;
+    }
+    if (length < SEARCHTRIGRAMLENGTH) return count;
+
+    // Use the shortest posting list of the trigrams of the query as candidates
+    const DWORD* pCandidates = NULL;
+    const DWORD* pCandidatesEnd = NULL;
+    for (size_t i = 0; i + SEARCHTRIGRAMLENGTH <= length; i++) {
+        std::vector<ULONGLONG>::const_iterator it = std::lower_bound(m_trigrams.begin(), m_trigrams.end(), getTrigram(szFolded + i));
+        if ((it == m_trigrams.end()) || (*it != getTrigram(szFolded + i))) return count; // Trigram is in no text
+        size_t trigram = it - m_trigrams.begin();
+        const DWORD* pStart = m_postings.data() + m_postingStart[trigram];
+        const DWORD* pEnd = m_postings.data() + m_postingStart[trigram + 1];
+        if ((pCandidates == NULL) || (pEnd - pStart < pCandidatesEnd - pCandidates)) {
+            pCandidates = pStart;
+            pCandidatesEnd = pEnd;
+        }
+    }
+
+    // Check candidates and skip entries already found by the name
+    for (const DWORD* p = pCandidates; (p < pCandidatesEnd) && (count < maxHits); p++) {
+        const Entry& entry = m_entries[*p];
+        if ((dwSources & SOURCEBIT(entry.hit.source)) == 0) continue;
+        if (wcsstr(getFolded(*p), szFolded) == NULL) continue;
+        if ((entry.nameLength >= length) && (wcsncmp(getFolded(*p), szFolded, length) == 0)) continue; // Found by name
+        pHits[count++] = entry.hit;
+    }
+    return count;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getSearchIndex
+
+  Summary:  Get search index. The index is built on the first call.
+
+  Args:
+
+  Returns:  const SearchIndex&
+
+-----------------------------------------------------------------F-F*/
+const SearchIndex& getSearchIndex() {
+    static const SearchIndex* s_pIndex = new SearchIndex(); // Never released, used until the program ends
+    return *s_pIndex;
+}
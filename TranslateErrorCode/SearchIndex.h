@@ -0,0 +1,52 @@
+#pragma once
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+#include "CodeIndex.h"
+#include <vector>
+
+// Min chars of a query for the text search (shorter queries search only symbolic names)
+#define SEARCHTRIGRAMLENGTH 3
+
+// Max chars of a query
+#define MAXSEARCHQUERYLENGTH 100
+
+// Max number of results for one search
+#define MAXSEARCHRESULTS 100
+
+// Error code found by a search. The text is valid until the program ends.
+struct SearchHit {
+    ErrorSource source;
+    DWORD code;
+    const wchar_t* szText;
+    size_t length;
+};
+
+// Index for the search of symbolic names (prefix) and texts (substring) in
+// all sources. Symbolic names are found by binary search in a sorted name
+// table, texts by a trigram index, so no query needs a scan of all texts.
+class SearchIndex {
+public:
+    SearchIndex();
+    size_t search(const wchar_t* szQuery, SearchHit* pHits, size_t maxHits, DWORD dwSources = SOURCEMASK_ALL) const;
+    size_t size() const { return m_entries.size(); }
+private:
+    struct Entry {
+        SearchHit hit;
+        DWORD foldedOffset; // Lower case text in m_folded
+        DWORD nameLength;   // Length of the symbolic name at the begin of the text, 0 = no name
+    };
+    void add(ErrorSource source, DWORD dwCode, const wchar_t* szText, size_t length);
+    void buildNames();
+    void buildTrigrams();
+    const wchar_t* getFolded(DWORD index) const { return m_folded.data() + m_entries[index].foldedOffset; }
+    std::vector<Entry> m_entries;
+    std::vector<wchar_t> m_folded;      // Zero terminated lower case texts
+    std::vector<DWORD> m_names;         // Entries with a symbolic name, sorted by name
+    std::vector<ULONGLONG> m_trigrams;  // Sorted trigrams
+    std::vector<DWORD> m_postingStart;  // Start of the entries for m_trigrams[i] in m_postings (size + 1 elements)
+    std::vector<DWORD> m_postings;      // Entry indices per trigram, ascending
+};
+
+const SearchIndex& getSearchIndex();
+void foldSearchText(const wchar_t* pText, size_t length, wchar_t* pFolded);
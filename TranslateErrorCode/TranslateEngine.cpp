@@ -0,0 +1,673 @@
+﻿/*+===================================================================
+  File:      TranslateEngine.cpp
+
+  Summary:   Lookup of an error code in all supported sources. Used by
+             the dialog and the command line batch mode.
+
+             The engine writes the messages from FormatMessage into its own
+             buffers and the results into a caller provided sink, so a
+             translation needs no heap allocations. Results of FormatMessage
+             are kept in a direct mapped cache, because batch input often
+             repeats the same codes. When a message snapshot exists, the
+             Win32/HRESULT and NTSTATUS texts are taken from the snapshot
+             without calling FormatMessage. The texts for WU, LDAP,
+             StopCode/BugCheck and Wininet come from the code database in
+             the program folder or from the built-in tables. The decoder
+             selects the sources from the facility of the code. The merged
+             code index answers for the snapshot and the code database
+             with one probe, a built-in table with one probe in its
+             compile time perfect hash.
+             Win32/HRESULT and NTSTATUS messages can be requested in up to
+             MAXLANGUAGES languages, each language has its own buffers and
+             its results are cached with its LANGID.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "TranslateEngine.h"
+#include "ErrorCodeTables.h"
+#include "MessageSnapshot.h"
+#include "ErrorCodeDecoder.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::TextBufferSink
+
+  Summary:  Constructor
+
+  Args:     wchar_t* pBuffer
+              Caller provided buffer for the text
+            size_t capacity
+              Size of buffer in chars (incl. termination)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+TextBufferSink::TextBufferSink(wchar_t* pBuffer, size_t capacity) : m_pBuffer(pBuffer), m_capacity(capacity), m_length(0) {
+    if (m_capacity > 0) m_pBuffer[0] = L'\0';
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::append
+
+  Summary:  Append text to the buffer (truncated, if buffer is full)
+
+  Args:     const wchar_t* pText
+              Text
+            size_t length
+              Length of text in chars
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TextBufferSink::append(const wchar_t* pText, size_t length) {
+    if (m_length + 1 >= m_capacity) return; // Buffer full
+    if (length > m_capacity - m_length - 1) length = m_capacity - m_length - 1;
+    wmemcpy(m_pBuffer + m_length, pText, length);
+    m_length += length;
+    m_pBuffer[m_length] = L'\0';
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::appendUnsigned
+
+  Summary:  Append decimal number without format string and temporaries
+
+  Args:     ULONGLONG qwValue
+              Number
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TextBufferSink::appendUnsigned(ULONGLONG qwValue) {
+    wchar_t szDigits[20]; // 18446744073709551615
+    size_t pos = _countof(szDigits);
+    do {
+        szDigits[--pos] = (wchar_t)(L'0' + qwValue % 10);
+        qwValue /= 10;
+    } while (qwValue != 0);
+    append(szDigits + pos, _countof(szDigits) - pos);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::appendSigned
+
+  Summary:  Append decimal number with sign
+
+  Args:     LONGLONG llValue
+              Number
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TextBufferSink::appendSigned(LONGLONG llValue) {
+    if (llValue < 0) {
+        append(L"-", 1);
+        appendUnsigned(0 - (ULONGLONG)llValue); // Also for LLONG_MIN
+    } else appendUnsigned((ULONGLONG)llValue);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::appendHex
+
+  Summary:  Append hexadecimal number (uppercase, without 0x)
+
+  Args:     ULONGLONG qwValue
+              Number
+            size_t digits
+              Min number of digits, filled with leading zeros (max 16)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TextBufferSink::appendHex(ULONGLONG qwValue, size_t digits) {
+    static const wchar_t HEXDIGITS[] = L"0123456789ABCDEF";
+    wchar_t szDigits[16]; // FFFFFFFFFFFFFFFF
+    if (digits > _countof(szDigits)) digits = _countof(szDigits);
+    size_t pos = _countof(szDigits);
+    do {
+        szDigits[--pos] = HEXDIGITS[qwValue & 0xF];
+        qwValue >>= 4;
+    } while ((qwValue != 0) || (_countof(szDigits) - pos < digits));
+    append(szDigits + pos, _countof(szDigits) - pos);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TextBufferSink::addResult
+
+  Summary:  Append result of one source as "\r\n\r\nSource: Text" or
+            "\r\n\r\nSource (Language): Text"
+
+  Args:     const SourceResult& result
+              Result
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TextBufferSink::addResult(const SourceResult& result) {
+    wchar_t szTag[LANGUAGETAGSIZE];
+    append(L"\r\n\r\n", 4);
+    append(getSourceName(result.source));
+    size_t tagLength = getLanguageTag(result.langId, szTag);
+    if (tagLength > 0) {
+        append(L" (", 2);
+        append(szTag, tagLength);
+        append(L")", 1);
+    }
+    append(L": ", 2);
+    append(result.szText, result.length);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: MessageCache::MessageCache
+
+  Summary:  Constructor. The entries are allocated on the first store,
+            so engines without FormatMessage calls (e.g. the engine of
+            the dialog in command line modes) need no memory for them.
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+MessageCache::MessageCache() {
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: MessageCache::getIndex
+
+  Summary:  Get cache entry index for a key (multiplicative hash)
+
+  Args:     ErrorSource source
+            DWORD dwCode
+            LANGID langId
+              Key
+
+  Returns:  size_t
+
+-----------------------------------------------------------------F-F*/
+size_t MessageCache::getIndex(ErrorSource source, DWORD dwCode, LANGID langId) {
+    DWORD dwHash = (dwCode ^ ((DWORD)langId << 16) ^ ((DWORD)source << 29)) * 2654435761u;
+    return dwHash >> (32 - MESSAGECACHEBITS);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: MessageCache::find
+
+  Summary:  Get cached message
+
+  Args:     ErrorSource source
+            DWORD dwCode
+            LANGID langId
+              Key
+            wchar_t* pBuffer
+              Receives the message (MESSAGEBUFFERSIZE chars)
+            size_t& length
+              Receives the length of the message (0 = code has no message)
+
+  Returns:  bool
+              true = Key was found in cache
+              false = Key is not cached
+
+-----------------------------------------------------------------F-F*/
+bool MessageCache::find(ErrorSource source, DWORD dwCode, LANGID langId, wchar_t* pBuffer, size_t& length) const {
+    if (m_entries.empty()) return false;
+    const Entry& entry = m_entries[getIndex(source, dwCode, langId)];
+    if (!entry.bValid || (entry.code != dwCode) || (entry.langId != langId) || (entry.source != source)) return false;
+    length = entry.length;
+    wmemcpy(pBuffer, entry.text, length + 1);
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: MessageCache::store
+
+  Summary:  Store message in cache (replaces the previous entry with the same index)
+
+  Args:     ErrorSource source
+            DWORD dwCode
+            LANGID langId
+              Key
+            const wchar_t* pText
+              Zero terminated message
+            size_t length
+              Length of the message (0 = code has no message)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void MessageCache::store(ErrorSource source, DWORD dwCode, LANGID langId, const wchar_t* pText, size_t length) {
+    if (length >= MESSAGECACHETEXTSIZE) return; // Too long for the cache
+    if (m_entries.empty()) { // First store, all entries at once
+        m_entries.resize((size_t)1 << MESSAGECACHEBITS);
+        for (Entry& entry : m_entries) entry.bValid = false;
+    }
+    Entry& entry = m_entries[getIndex(source, dwCode, langId)];
+    entry.code = dwCode;
+    entry.langId = langId;
+    entry.source = (BYTE)source;
+    entry.length = (WORD)length;
+    wmemcpy(entry.text, pText, length + 1);
+    entry.bValid = true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TranslateEngine::TranslateEngine
+
+  Summary:  Constructor
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+TranslateEngine::TranslateEngine() : m_stats() {
+    m_hNtdll = GetModuleHandle(L"ntdll.dll"); // Always loaded, so the handle is valid for the lifetime of the process
+    m_pSnapshot = NULL;
+    m_pIndex = NULL;
+    m_languages[0].langId = DEFAULTLANGID;
+    m_languages[0].bAvailable[SOURCE_WIN32] = true;
+    m_languages[0].bAvailable[SOURCE_NTSTATUS] = true;
+    m_languageCount = 1;
+    m_dwSources = SOURCEMASK_ALL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TranslateEngine::setLanguages
+
+  Summary:  Set languages for Win32/HRESULT and NTSTATUS messages. Each
+            language is checked once with a known message, so languages
+            without installed language resources cost no FormatMessage
+            calls during the translations.
+
+  Args:     const LANGID* pLangIds
+              Languages (DEFAULTLANGID = Language of the user interface)
+            size_t count
+              Number of languages (0 = only DEFAULTLANGID, max. MAXLANGUAGES)
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TranslateEngine::setLanguages(const LANGID* pLangIds, size_t count) {
+    if (count == 0) {
+        m_languageCount = 1;
+        m_languages[0].langId = DEFAULTLANGID;
+        m_languages[0].bAvailable[SOURCE_WIN32] = true;
+        m_languages[0].bAvailable[SOURCE_NTSTATUS] = true;
+        return;
+    }
+    if (count > MAXLANGUAGES) count = MAXLANGUAGES;
+    for (size_t i = 0; i < count; i++) {
+        Language& language = m_languages[i];
+        language.langId = pLangIds[i];
+        if (language.langId == DEFAULTLANGID) {
+            language.bAvailable[SOURCE_WIN32] = true;
+            language.bAvailable[SOURCE_NTSTATUS] = true;
+            continue;
+        }
+        language.bAvailable[SOURCE_WIN32] = (formatMessageText(FORMAT_MESSAGE_FROM_SYSTEM, NULL, ERROR_ACCESS_DENIED, language.langId, language.szWin32) > 0);
+        language.bAvailable[SOURCE_NTSTATUS] = (m_hNtdll != NULL) &&
+            (formatMessageText(FORMAT_MESSAGE_FROM_HMODULE, m_hNtdll, (DWORD)STATUS_ACCESS_VIOLATION, language.langId, language.szNTStatus) > 0);
+    }
+    m_languageCount = count;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TranslateEngine::initialize
+
+  Summary:  Get snapshot and code index on the first translation, so
+            creating an engine (e.g. the global engine of the dialog)
+            costs nothing at program start. Snapshot and index are
+            loaded only once for all threads (thread safe initialization
+            of the function local statics), later calls just return them.
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void TranslateEngine::initialize() {
+    m_pSnapshot = getMessageSnapshot();
+    m_pIndex = &getCodeIndex();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: warmUpThreadProc
+
+  Summary:  Thread function to load snapshot and code index in the background
+
+  Args:     LPVOID lpParameter
+              Not used
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+DWORD WINAPI warmUpThreadProc(LPVOID lpParameter) {
+    UNREFERENCED_PARAMETER(lpParameter);
+    getMessageSnapshot();
+    getCodeIndex();
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: startWarmUp
+
+  Summary:  Load snapshot and code index in a background thread with low
+            priority, so the first translation does not wait for them. A
+            translation started before the thread has finished waits for
+            the thread instead of loading them again.
+
+  Args:
+
+  Returns:  bool
+              true = Thread was started
+
+-----------------------------------------------------------------F-F*/
+bool startWarmUp() {
+    HANDLE hThread = CreateThread(NULL, 0, warmUpThreadProc, NULL, CREATE_SUSPENDED, NULL);
+    if (hThread == NULL) return false;
+    SetThreadPriority(hThread, THREAD_PRIORITY_BELOW_NORMAL);
+    ResumeThread(hThread);
+    CloseHandle(hThread); // Runs detached
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: formatMessageText
+
+  Summary:  Get message from system or module message table without
+            line breaks at begin or end
+
+  Args:     DWORD dwFlags
+              FORMAT_MESSAGE_FROM_SYSTEM or FORMAT_MESSAGE_FROM_HMODULE
+            HMODULE hModule
+              Module for FORMAT_MESSAGE_FROM_HMODULE
+            DWORD dwCode
+              Error code
+            LANGID langId
+              Language
+            wchar_t* pBuffer
+              Buffer with MESSAGEBUFFERSIZE chars
+
+  Returns:  size_t
+              Length of message, 0 = error code was not found
+
+-----------------------------------------------------------------F-F*/
+size_t formatMessageText(DWORD dwFlags, HMODULE hModule, DWORD dwCode, LANGID langId, wchar_t* pBuffer) {
+    size_t length = FormatMessage(dwFlags | FORMAT_MESSAGE_IGNORE_INSERTS,
+        hModule, dwCode, langId, pBuffer, MESSAGEBUFFERSIZE, NULL);
+    size_t start = 0;
+    while ((length > 0) && ((pBuffer[length - 1] == L'\r') || (pBuffer[length - 1] == L'\n'))) length--;
+    while ((start < length) && ((pBuffer[start] == L'\r') || (pBuffer[start] == L'\n'))) start++;
+    if (start > 0) wmemmove(pBuffer, pBuffer + start, length - start);
+    length -= start;
+    pBuffer[length] = L'\0';
+    return length;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TranslateEngine::getMessage
+
+  Summary:  Get Win32/HRESULT or NTSTATUS message from snapshot, cache or FormatMessage
+
+  Args:     ErrorSource source
+              SOURCE_WIN32 or SOURCE_NTSTATUS
+            DWORD dwCode
+              Error code
+            LANGID langId
+              Language
+            wchar_t* pBuffer
+              Buffer for the message (MESSAGEBUFFERSIZE chars)
+            const wchar_t** pszText
+              Receives the message (pBuffer or text from the snapshot)
+
+  Returns:  size_t
+              Length of message, 0 = error code was not found
+
+-----------------------------------------------------------------F-F*/
+size_t TranslateEngine::getMessage(ErrorSource source, DWORD dwCode, LANGID langId, wchar_t* pBuffer, const wchar_t** pszText) {
+    size_t length = 0;
+    if ((m_pSnapshot != NULL) && (langId == DEFAULTLANGID)) {
+        // The snapshot contains all messages, so a missing code is not searched again
+        StageTimer timer(m_stats, STAGE_SNAPSHOT);
+        if (!m_pSnapshot->find(source, dwCode, pszText, &length)) length = 0;
+        return length;
+    }
+
+    *pszText = pBuffer;
+    bool bInstrumented = isInstrumented();
+    if (m_cache.find(source, dwCode, langId, pBuffer, length)) {
+        if (bInstrumented) m_stats.cacheHits++;
+        return length;
+    }
+    if (bInstrumented) m_stats.cacheMisses++;
+
+    StageTimer timer(m_stats, STAGE_FORMATMESSAGE);
+    if (source == SOURCE_WIN32) {
+        length = formatMessageText(FORMAT_MESSAGE_FROM_SYSTEM, NULL, dwCode, langId, pBuffer);
+    } else if (m_hNtdll != NULL) {
+        length = formatMessageText(FORMAT_MESSAGE_FROM_HMODULE, m_hNtdll, dwCode, langId, pBuffer);
+    } else pBuffer[0] = L'\0';
+    m_cache.store(source, dwCode, langId, pBuffer, length);
+    return length;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TranslateEngine::translate
+
+  Summary:  Lookup error code in the sources matching the HRESULT/NTSTATUS
+            facility of the code
+
+  Args:     DWORD dwCode
+              Error code
+            OutputSink& sink
+              Receives one result for each source knowing the error code
+            DWORD dwSources
+              Mask of the sources to search (SOURCEBIT). Other sources
+              are skipped without any lookup or FormatMessage call.
+
+  Returns:  size_t
+              Number of results
+
+-----------------------------------------------------------------F-F*/
+size_t TranslateEngine::translate(DWORD dwCode, OutputSink& sink, DWORD dwSources) {
+    size_t count = 0;
+    size_t length;
+    const wchar_t* szText;
+    DecodedErrorCode decoded;
+    SourceLookup lookups[SOURCE_COUNT];
+
+    if (m_pIndex == NULL) initialize();
+    bool bInstrumented = isInstrumented();
+
+    // Search only in the sources selected by the facility of the code
+    decodeErrorCode(dwCode, &decoded);
+    size_t lookupCount = getSourceLookups(decoded, lookups);
+    const CodeIndexEntry* pEntry = NULL;
+    DWORD dwIndexCode = 0;
+    bool bIndexSearched = false;
+    for (size_t i = 0; i < lookupCount; i++) {
+        const SourceLookup& lookup = lookups[i];
+        if ((dwSources & SOURCEBIT(lookup.source)) == 0) continue;
+        // Win32/HRESULT and NTSTATUS in each language, the other sources have only one language
+        bool bLanguages = (lookup.source == SOURCE_WIN32) || (lookup.source == SOURCE_NTSTATUS);
+        size_t languageCount = bLanguages ? m_languageCount : 1;
+        for (size_t j = 0; j < languageCount; j++) {
+            Language& language = m_languages[j];
+            LANGID langId = bLanguages ? language.langId : LANG_NEUTRAL;
+            if (bLanguages && !language.bAvailable[lookup.source]) continue;
+            const ErrorCodeTable* pTable = (m_pIndex->sources() & SOURCEBIT(lookup.source)) ? NULL : getSourceTable(lookup.source);
+            if (pTable != NULL) { // Built-in table without code database, one probe in its perfect hash
+                std::wstring_view text;
+                {
+                    StageTimer timer(m_stats, STAGE_TABLE);
+                    text = pTable->find(lookup.code);
+                }
+                if (text.empty()) continue;
+                szText = text.data(); // View of a string literal, zero terminated
+                length = text.size();
+            } else if ((m_pIndex->sources() & SOURCEBIT(lookup.source)) && (!bLanguages || (langId == DEFAULTLANGID))) {
+                // One probe answers for all sources with the same code
+                if (!bIndexSearched || (dwIndexCode != lookup.code)) {
+                    StageTimer timer(m_stats, STAGE_INDEX);
+                    pEntry = m_pIndex->find(lookup.code);
+                    dwIndexCode = lookup.code;
+                    bIndexSearched = true;
+                    if (bInstrumented) ((pEntry != NULL) ? m_stats.indexHits : m_stats.indexMisses)++;
+                }
+                if ((pEntry == NULL) || !m_pIndex->getText(*pEntry, lookup.source, &szText, &length)) continue;
+            } else { // Win32/HRESULT or NTSTATUS without snapshot or in another language
+                length = getMessage(lookup.source, lookup.code, langId, (lookup.source == SOURCE_WIN32) ? language.szWin32 : language.szNTStatus, &szText);
+                if (length == 0) continue;
+            }
+            sink.addResult({ lookup.source, szText, length, langId });
+            count++;
+        }
+    }
+    if (bInstrumented) {
+        m_stats.lookups++;
+        m_stats.results += count;
+        TraceLoggingWrite(g_hTraceProvider, "Lookup", TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+            TraceLoggingHexUInt32(dwCode, "Code"),
+            TraceLoggingUInt32((UINT32)count, "Results"),
+            TraceLoggingUInt64(m_stats.cacheHits, "CacheHits"),
+            TraceLoggingUInt64(m_stats.cacheMisses, "CacheMisses"));
+    }
+    return count;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getLanguageTag
+
+  Summary:  Get tag (like "de-DE") of a language for the output
+
+  Args:     LANGID langId
+              Language
+            wchar_t* pBuffer
+              Buffer with LANGUAGETAGSIZE chars
+
+  Returns:  size_t
+              Length of the tag, 0 = DEFAULTLANGID or LANG_NEUTRAL (no tag needed)
+
+-----------------------------------------------------------------F-F*/
+size_t getLanguageTag(LANGID langId, wchar_t* pBuffer) {
+    pBuffer[0] = L'\0';
+    if ((langId == DEFAULTLANGID) || (langId == LANG_NEUTRAL)) return 0;
+    int iLength = LCIDToLocaleName(MAKELCID(langId, SORT_DEFAULT), pBuffer, LANGUAGETAGSIZE, 0);
+    if (iLength > 1) return iLength - 1;
+    return _snwprintf_s(pBuffer, LANGUAGETAGSIZE, _TRUNCATE, L"0x%04X", langId); // Unknown to the system
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseLanguageList
+
+  Summary:  Parse list of languages separated by ',', ';' or spaces. A
+            language is a locale name (like "de-DE" or "en-US"), a hex
+            LANGID (like 0x0407 or 0407) or "default" for the language of the user
+            interface. Duplicates are ignored.
+
+  Args:     const wchar_t* szList
+              List
+            LANGID* pLangIds
+              Array with MAXLANGUAGES elements for the languages
+
+  Returns:  size_t
+              Number of languages, 0 = invalid list
+
+-----------------------------------------------------------------F-F*/
+size_t parseLanguageList(const wchar_t* szList, LANGID* pLangIds) {
+    size_t count = 0;
+    wchar_t szName[LOCALE_NAME_MAX_LENGTH];
+    const wchar_t* pPos = szList;
+    for (;;) {
+        while ((*pPos == L',') || (*pPos == L';') || (*pPos == L' ')) pPos++;
+        if (*pPos == L'\0') break;
+        size_t length = 0;
+        while ((pPos[length] != L'\0') && (pPos[length] != L',') && (pPos[length] != L';') && (pPos[length] != L' ')) length++;
+        if (length >= LOCALE_NAME_MAX_LENGTH) return 0;
+        wmemcpy(szName, pPos, length);
+        szName[length] = L'\0';
+        pPos += length;
+
+        LANGID langId;
+        if (_wcsicmp(szName, L"default") == 0) {
+            langId = DEFAULTLANGID;
+        } else if ((szName[0] >= L'0') && (szName[0] <= L'9')) {
+            // LANGIDs are written in hex, "0x" is optional
+            const wchar_t* pDigits = szName;
+            if ((pDigits[0] == L'0') && ((pDigits[1] == L'x') || (pDigits[1] == L'X'))) pDigits += 2;
+            wchar_t* pEnd = NULL;
+            unsigned long ulValue = wcstoul(pDigits, &pEnd, 16);
+            if ((pEnd == pDigits) || (*pEnd != L'\0') || (ulValue == 0) || (ulValue > 0xFFFF)) return 0;
+            langId = (LANGID)ulValue;
+        } else {
+            LCID lcid = LocaleNameToLCID(szName, 0);
+            if (lcid == 0) return 0;
+            langId = LANGIDFROMLCID(lcid);
+        }
+
+        bool bDuplicate = false;
+        for (size_t i = 0; i < count; i++) bDuplicate |= (pLangIds[i] == langId);
+        if (bDuplicate) continue;
+        if (count >= MAXLANGUAGES) return 0; // Too many languages
+        pLangIds[count++] = langId;
+    }
+    return count;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: parseSourceList
+
+  Summary:  Parse list of sources separated by ',', ';' or spaces. A
+            source is "win32" (or "hresult"), "ntstatus", "wu", "ldap",
+            "bugcheck" (or "stopcode"), "wininet", its display name or
+            "all" for all sources.
+
+  Args:     const wchar_t* szList
+              List
+
+  Returns:  DWORD
+              Mask of the sources (SOURCEBIT), 0 = invalid list
+
+-----------------------------------------------------------------F-F*/
+DWORD parseSourceList(const wchar_t* szList) {
+    static const struct {
+        const wchar_t* szName;
+        DWORD dwSources;
+    } c_aNames[] = {
+        { L"all", SOURCEMASK_ALL },
+        { L"win32", SOURCEBIT(SOURCE_WIN32) },
+        { L"hresult", SOURCEBIT(SOURCE_WIN32) },
+        { L"ntstatus", SOURCEBIT(SOURCE_NTSTATUS) },
+        { L"wu", SOURCEBIT(SOURCE_WU) },
+        { L"ldap", SOURCEBIT(SOURCE_LDAP) },
+        { L"bugcheck", SOURCEBIT(SOURCE_BUGCHECK) },
+        { L"stopcode", SOURCEBIT(SOURCE_BUGCHECK) },
+        { L"wininet", SOURCEBIT(SOURCE_WININET) },
+    };
+    DWORD dwSources = 0;
+    wchar_t szName[40];
+    const wchar_t* pPos = szList;
+    for (;;) {
+        while ((*pPos == L',') || (*pPos == L';') || (*pPos == L' ')) pPos++;
+        if (*pPos == L'\0') break;
+        size_t length = 0;
+        while ((pPos[length] != L'\0') && (pPos[length] != L',') && (pPos[length] != L';') && (pPos[length] != L' ')) length++;
+        if (length >= _countof(szName)) return 0;
+        wmemcpy(szName, pPos, length);
+        szName[length] = L'\0';
+        pPos += length;
+
+        DWORD dwSource = 0;
+        ErrorSource source;
+        for (size_t i = 0; i < _countof(c_aNames); i++) {
+            if (_wcsicmp(szName, c_aNames[i].szName) == 0) dwSource = c_aNames[i].dwSources;
+        }
+        if ((dwSource == 0) && getSourceByName(szName, &source)) dwSource = SOURCEBIT(source);
+        if (dwSource == 0) return 0;
+        dwSources |= dwSource;
+    }
+    return dwSources;
+}
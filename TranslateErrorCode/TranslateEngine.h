@@ -0,0 +1,132 @@
+#pragma once
+
+#include "framework.h"
+#include "ErrorCodeTables.h"
+#include "CodeDatabase.h"
+#include "CodeIndex.h"
+#include "Instrumentation.h"
+#include <vector>
+
+// Max chars (incl. termination) for a message from FormatMessage
+#define MESSAGEBUFFERSIZE 4096
+
+// Max number of languages for Win32/HRESULT and NTSTATUS messages
+#define MAXLANGUAGES 4
+
+// Max number of results for one error code (all sources and Win32/HRESULT
+// and NTSTATUS for each additional language)
+#define MAXRESULTS (SOURCE_COUNT + 2 * (MAXLANGUAGES - 1))
+
+// Number of entries (2^MESSAGECACHEBITS) in the message cache
+#define MESSAGECACHEBITS 9
+
+// Max chars (incl. termination) for a cached message. Longer messages are not cached.
+#define MESSAGECACHETEXTSIZE 512
+
+// Default language for FormatMessage
+#define DEFAULTLANGID MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT)
+
+// Max chars (incl. termination) for a language tag like "de-DE"
+#define LANGUAGETAGSIZE 86
+
+// Text for an error code from one source. The text is zero terminated and
+// valid until the next translation with the same engine.
+struct SourceResult {
+    ErrorSource source;
+    const wchar_t* szText;
+    size_t length;
+    LANGID langId;  // Language of the text, LANG_NEUTRAL = Source has only one language
+};
+
+// Receiver for the results of a translation
+class OutputSink {
+public:
+    virtual ~OutputSink() {}
+    virtual void addResult(const SourceResult& result) = 0;
+};
+
+// Sink collecting the results in a fixed array
+class ResultListSink : public OutputSink {
+public:
+    void clear() { count = 0; }
+    void addResult(const SourceResult& result) override {
+        if (count < MAXRESULTS) results[count++] = result;
+    }
+    SourceResult results[MAXRESULTS];
+    size_t count = 0;
+};
+
+// Sink writing the results as text ("\r\n\r\nSource: Text") to a caller provided buffer
+class TextBufferSink : public OutputSink {
+public:
+    TextBufferSink(wchar_t* pBuffer, size_t capacity);
+    void append(const wchar_t* pText, size_t length);
+    void append(const wchar_t* szText) { append(szText, wcslen(szText)); }
+    void appendUnsigned(ULONGLONG qwValue);
+    void appendSigned(LONGLONG llValue);
+    void appendHex(ULONGLONG qwValue, size_t digits);
+    void addResult(const SourceResult& result) override;
+    const wchar_t* text() const { return m_pBuffer; }
+    size_t length() const { return m_length; }
+private:
+    wchar_t* m_pBuffer;
+    size_t m_capacity;
+    size_t m_length;
+};
+
+// Direct mapped cache for the results (incl. "not found") of FormatMessage
+class MessageCache {
+public:
+    MessageCache();
+    bool find(ErrorSource source, DWORD dwCode, LANGID langId, wchar_t* pBuffer, size_t& length) const;
+    void store(ErrorSource source, DWORD dwCode, LANGID langId, const wchar_t* pText, size_t length);
+private:
+    struct Entry {
+        DWORD code;
+        LANGID langId;
+        BYTE source;
+        bool bValid;
+        WORD length;
+        wchar_t text[MESSAGECACHETEXTSIZE];
+    };
+    static size_t getIndex(ErrorSource source, DWORD dwCode, LANGID langId);
+    std::vector<Entry> m_entries; // Empty until the first store
+};
+
+// Lookup of error codes in all sources. Not thread safe, use one engine per thread.
+class TranslateEngine {
+public:
+    TranslateEngine();
+    size_t translate(DWORD dwCode, OutputSink& sink) { return translate(dwCode, sink, m_dwSources); }
+    size_t translate(DWORD dwCode, OutputSink& sink, DWORD dwSources);
+    void setSources(DWORD dwSources) { m_dwSources = dwSources & SOURCEMASK_ALL; }
+    DWORD sources() const { return m_dwSources; }
+    void setLanguages(const LANGID* pLangIds, size_t count);
+    size_t languageCount() const { return m_languageCount; }
+    LANGID language(size_t index) const { return m_languages[index].langId; }
+    LookupStats& stats() { return m_stats; }
+private:
+    // Language for Win32/HRESULT and NTSTATUS messages with own buffers
+    struct Language {
+        LANGID langId;
+        bool bAvailable[2];   // Messages of SOURCE_WIN32 and SOURCE_NTSTATUS exist in this language
+        wchar_t szWin32[MESSAGEBUFFERSIZE];
+        wchar_t szNTStatus[MESSAGEBUFFERSIZE];
+    };
+    void initialize();
+    size_t getMessage(ErrorSource source, DWORD dwCode, LANGID langId, wchar_t* pBuffer, const wchar_t** pszText);
+    HMODULE m_hNtdll;
+    const CodeDatabase* m_pSnapshot;
+    const CodeIndex* m_pIndex;     // NULL = Not yet initialized
+    MessageCache m_cache;
+    Language m_languages[MAXLANGUAGES];
+    size_t m_languageCount;
+    DWORD m_dwSources;             // Sources searched by translate without a mask
+    LookupStats m_stats;
+};
+
+bool startWarmUp();
+size_t formatMessageText(DWORD dwFlags, HMODULE hModule, DWORD dwCode, LANGID langId, wchar_t* pBuffer);
+size_t parseLanguageList(const wchar_t* szList, LANGID* pLangIds);
+DWORD parseSourceList(const wchar_t* szList);
+size_t getLanguageTag(LANGID langId, wchar_t* pBuffer);
@@ -3,3 +3,6 @@
 #include "resource.h"
 #include <vector>
 #include <string>
+
+std::wstring LoadStringAsWstr(HINSTANCE hInstance, UINT uID);
+INT_PTR CALLBACK WndProcMainDialog(HWND, UINT, WPARAM, LPARAM);
@@ -0,0 +1,622 @@
+﻿/*+===================================================================
+  File:      Bench.cpp
+
+  Summary:   Benchmark suite for the lookup, parse and formatting paths.
+             Measures the startup (snapshot, code database, code index and
+             search index, start of TranslateErrorCode.exe until the first
+             paint of the dialog), the lookup latency per source, FormatMessage
+             cold and warm, the error code parser compared to StrToIntEx,
+             the throughput of TranslateEngine::translate and of the dialog
+             output for a realistic mix of codes and the memory footprint.
+
+             Usage: TranslateErrorCodeBench [/format:csv|json] [/iterations:N]
+
+             The results are written to stdout as CSV (default) or JSON, so
+             runs can be compared to find regressions.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "CodeParser.h"
+#include "CodeIndex.h"
+#include "CodeDatabase.h"
+#include "ErrorCodeTables.h"
+#include "LiveTranslation.h"
+#include "MessageSnapshot.h"
+#include "SearchIndex.h"
+#include "TranslateEngine.h"
+#include <psapi.h>
+#include <shlwapi.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#pragma comment(lib,"shlwapi.lib")
+#pragma comment(lib,"psapi.lib")
+
+// Default number of passes over all inputs
+#define DEFAULTITERATIONS 20
+// Number of generated inputs
+#define BENCHINPUTS 10000
+// Number of codes for the FormatMessage benchmark
+#define FORMATMESSAGECODES 2000
+// Number of starts of TranslateErrorCode.exe for the startup measurement
+#define PROCESSSTARTRUNS 5
+// Max ms to wait for a started TranslateErrorCode.exe
+#define PROCESSSTARTTIMEOUT 10000
+
+// Result of one measurement
+struct BenchResult {
+    std::wstring sName;
+    double value;
+    const wchar_t* szUnit;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getTimestamp
+
+  Summary:  Get current value of the performance counter
+
+  Args:
+
+  Returns:  LONGLONG
+
+-----------------------------------------------------------------F-F*/
+LONGLONG getTimestamp() {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getMilliseconds
+
+  Summary:  Get elapsed time since a performance counter value
+
+  Args:     LONGLONG start
+              Performance counter value at the start
+
+  Returns:  double
+              Milliseconds
+
+-----------------------------------------------------------------F-F*/
+double getMilliseconds(LONGLONG start) {
+    LONGLONG end = getTimestamp();
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return (double)(end - start) * 1000.0 / (double)frequency.QuadPart;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getPrivateBytes
+
+  Summary:  Get private memory of the process
+
+  Args:
+
+  Returns:  double
+              KiB
+
+-----------------------------------------------------------------F-F*/
+double getPrivateBytes() {
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+    counters.cb = sizeof(counters);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), (PPROCESS_MEMORY_COUNTERS)&counters, sizeof(counters))) return 0;
+    return (double)counters.PrivateUsage / 1024.0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getRandom
+
+  Summary:  Reproducible pseudo random numbers (LCG)
+
+  Args:     DWORD& dwSeed
+              State
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+inline DWORD getRandom(DWORD& dwSeed) {
+    dwSeed = dwSeed * 1664525 + 1013904223;
+    return dwSeed ^ (dwSeed >> 16);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: createCodeMix
+
+  Summary:  Create a realistic mix of error codes as found in logs and
+            batch input: 35% HRESULT_FROM_WIN32, 15% WU, 15% NTSTATUS,
+            10% plain Win32, 5% Wininet, 5% stop codes, 15% unknown codes
+
+  Args:     std::vector<DWORD>& codes
+              Receives the codes
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void createCodeMix(std::vector<DWORD>& codes) {
+    DWORD dwSeed = 0x12345678;
+    codes.clear();
+    for (int i = 0; i < BENCHINPUTS; i++) {
+        DWORD dwRandom = getRandom(dwSeed);
+        DWORD dwKind = dwRandom % 100;
+        dwRandom >>= 8;
+        if (dwKind < 35) codes.push_back(0x80070000 | (dwRandom % 1500));
+        else if (dwKind < 50) codes.push_back(g_tblWU.pEntries[dwRandom % g_tblWU.count].code);
+        else if (dwKind < 65) codes.push_back(0xC0000000 | (dwRandom % 0x300));
+        else if (dwKind < 75) codes.push_back(dwRandom % 1500);
+        else if (dwKind < 80) codes.push_back(0x80070000 | g_tblWininet.pEntries[dwRandom % g_tblWininet.count].code);
+        else if (dwKind < 85) codes.push_back(g_tblBugCheck.pEntries[dwRandom % g_tblBugCheck.count].code);
+        else codes.push_back(getRandom(dwSeed));
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchStartup
+
+  Summary:  Measure time and memory for loading the snapshot and the code
+            database and for building the code index and the search index
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void benchStartup(std::vector<BenchResult>& results) {
+    double memory = getPrivateBytes();
+    LONGLONG start = getTimestamp();
+    const CodeDatabase* pSnapshot = getMessageSnapshot();
+    results.push_back({ L"startup.snapshot", getMilliseconds(start), L"ms" });
+    results.push_back({ L"startup.snapshot.loaded", (pSnapshot != NULL) ? 1.0 : 0.0, L"bool" });
+
+    start = getTimestamp();
+    const CodeDatabase* pDatabase = getCodeDatabase();
+    results.push_back({ L"startup.codedatabase", getMilliseconds(start), L"ms" });
+    results.push_back({ L"startup.codedatabase.loaded", (pDatabase != NULL) ? 1.0 : 0.0, L"bool" });
+    results.push_back({ L"memory.files", getPrivateBytes() - memory, L"KiB" });
+
+    memory = getPrivateBytes();
+    start = getTimestamp();
+    const CodeIndex& codeIndex = getCodeIndex();
+    results.push_back({ L"startup.codeindex", getMilliseconds(start), L"ms" });
+    results.push_back({ L"memory.codeindex", getPrivateBytes() - memory, L"KiB" });
+    results.push_back({ L"size.codeindex", (double)codeIndex.size(), L"codes" });
+
+    memory = getPrivateBytes();
+    start = getTimestamp();
+    const SearchIndex& searchIndex = getSearchIndex();
+    results.push_back({ L"startup.searchindex", getMilliseconds(start), L"ms" });
+    results.push_back({ L"memory.searchindex", getPrivateBytes() - memory, L"KiB" });
+    results.push_back({ L"size.searchindex", (double)searchIndex.size(), L"texts" });
+
+    memory = getPrivateBytes();
+    start = getTimestamp();
+    TranslateEngine* pEngine = new TranslateEngine();
+    results.push_back({ L"startup.engine", getMilliseconds(start), L"ms" });
+    results.push_back({ L"memory.engine", getPrivateBytes() - memory, L"KiB" });
+    delete pEngine;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: closeThreadWindow
+
+  Summary:  EnumThreadWindows callback, closes the dialog of the program
+
+  Args:     HWND hWnd
+              Window
+            LPARAM lParam
+              Unused
+
+  Returns:  BOOL
+              TRUE = Continue enumeration
+
+-----------------------------------------------------------------F-F*/
+BOOL CALLBACK closeThreadWindow(HWND hWnd, LPARAM lParam) {
+    UNREFERENCED_PARAMETER(lParam);
+    PostMessage(hWnd, WM_CLOSE, 0, 0);
+    return TRUE;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: measureProcessStart
+
+  Summary:  Start TranslateErrorCode.exe and measure the time until the
+            dialog waits for input (first paint done) or until a command
+            line mode has ended
+
+  Args:     const wchar_t* szExe
+              Path of TranslateErrorCode.exe
+            const wchar_t* szArgs
+              Command line arguments (NULL = dialog)
+
+  Returns:  double
+              Milliseconds, < 0 = Program could not be started
+
+-----------------------------------------------------------------F-F*/
+double measureProcessStart(const wchar_t* szExe, const wchar_t* szArgs) {
+    wchar_t szCommandLine[MAX_PATH + 100];
+    _snwprintf_s(szCommandLine, _countof(szCommandLine), _TRUNCATE, L"\"%s\" %s", szExe, (szArgs != NULL) ? szArgs : L"");
+    SECURITY_ATTRIBUTES sa = { sizeof(sa), NULL, TRUE };
+    HANDLE hNul = CreateFile(L"NUL", GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, &sa, OPEN_EXISTING, 0, NULL);
+    STARTUPINFO si = {};
+    si.cb = sizeof(si);
+    si.dwFlags = STARTF_USESTDHANDLES;
+    si.hStdInput = hNul;
+    si.hStdOutput = hNul;
+    si.hStdError = hNul;
+    PROCESS_INFORMATION pi;
+
+    LONGLONG start = getTimestamp();
+    if (!CreateProcess(NULL, szCommandLine, NULL, NULL, TRUE, 0, NULL, NULL, &si, &pi)) {
+        if (hNul != INVALID_HANDLE_VALUE) CloseHandle(hNul);
+        return -1;
+    }
+    double milliseconds;
+    if (szArgs == NULL) {
+        WaitForInputIdle(pi.hProcess, PROCESSSTARTTIMEOUT);
+        milliseconds = getMilliseconds(start);
+        EnumThreadWindows(pi.dwThreadId, closeThreadWindow, 0);
+    } else {
+        WaitForSingleObject(pi.hProcess, PROCESSSTARTTIMEOUT);
+        milliseconds = getMilliseconds(start);
+    }
+    if (WaitForSingleObject(pi.hProcess, PROCESSSTARTTIMEOUT) != WAIT_OBJECT_0) TerminateProcess(pi.hProcess, 1);
+    CloseHandle(pi.hThread);
+    CloseHandle(pi.hProcess);
+    if (hNul != INVALID_HANDLE_VALUE) CloseHandle(hNul);
+    return milliseconds;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchProcessStart
+
+  Summary:  Measure the start of TranslateErrorCode.exe (from the folder
+            of the benchmark) until the first paint of the dialog and
+            until the end of a short command line mode, and the duration
+            of a full export. Skipped, when the program does not exist.
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void benchProcessStart(std::vector<BenchResult>& results) {
+    wchar_t szExe[MAX_PATH];
+    DWORD dwLength = GetModuleFileName(NULL, szExe, _countof(szExe));
+    if ((dwLength == 0) || (dwLength >= _countof(szExe))) return;
+    PathRemoveFileSpec(szExe);
+    if (!PathAppend(szExe, L"TranslateErrorCode.exe") || (GetFileAttributes(szExe) == INVALID_FILE_ATTRIBUTES)) return;
+
+    double dialog = 0;
+    double command = 0;
+    double exportCsv = 0;
+    for (int i = 0; i < PROCESSSTARTRUNS; i++) {
+        double milliseconds = measureProcessStart(szExe, NULL);
+        if (milliseconds < 0) return;
+        dialog += milliseconds;
+        command += measureProcessStart(szExe, L"/list /range:0");
+        exportCsv += measureProcessStart(szExe, L"/export:csv");
+    }
+    results.push_back({ L"startup.process.dialog", dialog / PROCESSSTARTRUNS, L"ms" });
+    results.push_back({ L"startup.process.commandline", command / PROCESSSTARTRUNS, L"ms" });
+    results.push_back({ L"export.process.csv", exportCsv / PROCESSSTARTRUNS, L"ms" });
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchLookups
+
+  Summary:  Measure lookup latency in the built-in tables (per source)
+            and in the code index (snapshot and code database), half of
+            the codes are misses
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+            int iterations
+              Passes over all codes
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void benchLookups(std::vector<BenchResult>& results, int iterations) {
+    std::vector<DWORD> codes;
+    size_t found = 0; // Prevents removing the loops by the optimizer
+    for (int i = SOURCE_WU; i < SOURCE_COUNT; i++) {
+        ErrorSource source = (ErrorSource)i;
+        const ErrorCodeTable* pTable = getSourceTable(source);
+        DWORD dwSeed = 0x2468ACE0 + i;
+        codes.clear();
+        for (int j = 0; j < BENCHINPUTS; j++) {
+            DWORD dwRandom = getRandom(dwSeed);
+            codes.push_back((j & 1) ? dwRandom : pTable->pEntries[dwRandom % pTable->count].code);
+        }
+        LONGLONG start = getTimestamp();
+        for (int j = 0; j < iterations; j++) {
+            for (DWORD dwCode : codes) found += !pTable->find(dwCode).empty();
+        }
+        results.push_back({ std::wstring(L"lookup.table.") + getSourceName(source), getMilliseconds(start) * 1000000.0 / ((double)iterations * codes.size()), L"ns/op" });
+    }
+
+    // Code index, skipped without snapshot and code database
+    const CodeIndex& codeIndex = getCodeIndex();
+    if (codeIndex.size() > 0) {
+        DWORD dwSeed = 0x13579BDF;
+        codes.clear();
+        for (int j = 0; j < BENCHINPUTS; j++) {
+            DWORD dwRandom = getRandom(dwSeed);
+            codes.push_back((j & 1) ? dwRandom : codeIndex.begin()[dwRandom % codeIndex.size()].code);
+        }
+        LONGLONG start = getTimestamp();
+        for (int j = 0; j < iterations; j++) {
+            for (DWORD dwCode : codes) found += (codeIndex.find(dwCode) != NULL);
+        }
+        results.push_back({ L"lookup.codeindex", getMilliseconds(start) * 1000000.0 / ((double)iterations * codes.size()), L"ns/op" });
+    }
+    results.push_back({ L"lookup.found", (double)found, L"count" });
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchFormatMessage
+
+  Summary:  Measure FormatMessage for Win32/HRESULT and NTSTATUS codes on
+            the first call (cold) and for the same codes again (warm)
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void benchFormatMessage(std::vector<BenchResult>& results) {
+    std::vector<wchar_t> buffer(MESSAGEBUFFERSIZE);
+    HMODULE hNtdll = GetModuleHandle(L"ntdll.dll");
+    static const wchar_t* c_aszPasses[] = { L"cold", L"warm" };
+    for (const wchar_t* szPass : c_aszPasses) {
+        LONGLONG start = getTimestamp();
+        for (DWORD i = 0; i < FORMATMESSAGECODES; i++) formatMessageText(FORMAT_MESSAGE_FROM_SYSTEM, NULL, i, DEFAULTLANGID, buffer.data());
+        results.push_back({ std::wstring(L"formatmessage.win32.") + szPass, getMilliseconds(start) * 1000000.0 / FORMATMESSAGECODES, L"ns/op" });
+        if (hNtdll == NULL) continue;
+        start = getTimestamp();
+        for (DWORD i = 0; i < FORMATMESSAGECODES; i++) formatMessageText(FORMAT_MESSAGE_FROM_HMODULE, hNtdll, 0xC0000000 | i, DEFAULTLANGID, buffer.data());
+        results.push_back({ std::wstring(L"formatmessage.ntstatus.") + szPass, getMilliseconds(start) * 1000000.0 / FORMATMESSAGECODES, L"ns/op" });
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchParser
+
+  Summary:  Compare parseNumber with StrToIntEx for a mix of hex, decimal
+            and negative decimal inputs
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+            int iterations
+              Passes over all inputs
+
+  Returns:  bool
+              false = Parser results differ from StrToIntEx
+
+-----------------------------------------------------------------F-F*/
+bool benchParser(std::vector<BenchResult>& results, int iterations) {
+    std::vector<std::wstring> inputs;
+    DWORD dwSeed = 0x12345678;
+    wchar_t szInput[40];
+    for (int i = 0; i < BENCHINPUTS; i++) {
+        DWORD dwRandom = getRandom(dwSeed);
+        DWORD dwCode = (dwRandom & 1) ? (0x80070000 | (dwRandom >> 20)) : (0xC0000000 | (dwRandom >> 16));
+        switch ((dwRandom >> 8) % 20) {
+            case 0: case 1: case 2: case 3: case 4:
+                _snwprintf_s(szInput, _countof(szInput), _TRUNCATE, L"%d", (int)dwCode);
+                break;
+            case 5: case 6: case 7:
+                _snwprintf_s(szInput, _countof(szInput), _TRUNCATE, L"%u", dwRandom >> 22);
+                break;
+            default:
+                _snwprintf_s(szInput, _countof(szInput), _TRUNCATE, (dwRandom & 2) ? L"0x%08X" : L"0x%08x", dwCode);
+        }
+        inputs.push_back(szInput);
+    }
+
+    // Both parsers must give the same codes
+    for (const std::wstring& sInput : inputs) {
+        int iValue = 0;
+        ParsedNumber number;
+        DWORD dwCode = 0;
+        if (!StrToIntEx(sInput.c_str(), STIF_SUPPORT_HEX, &iValue) || (parseNumber(sInput.c_str(), sInput.length(), &number) != PARSE_OK)
+            || !getErrorCode(number, &dwCode) || (dwCode != (DWORD)iValue)) {
+            fwprintf(stderr, L"Parser mismatch for %ls\n", sInput.c_str());
+            return false;
+        }
+    }
+
+    DWORD dwChecksum = 0; // Prevents removing the loops by the optimizer
+    LONGLONG start = getTimestamp();
+    for (int i = 0; i < iterations; i++) {
+        for (const std::wstring& sInput : inputs) {
+            int iValue = 0;
+            if (StrToIntEx(sInput.c_str(), STIF_SUPPORT_HEX, &iValue)) dwChecksum += (DWORD)iValue;
+        }
+    }
+    results.push_back({ L"parse.strtointex", getMilliseconds(start) * 1000000.0 / ((double)iterations * inputs.size()), L"ns/op" });
+
+    start = getTimestamp();
+    for (int i = 0; i < iterations; i++) {
+        for (const std::wstring& sInput : inputs) {
+            ParsedNumber number;
+            DWORD dwCode;
+            if ((parseNumber(sInput.c_str(), sInput.length(), &number) == PARSE_OK) && getErrorCode(number, &dwCode)) dwChecksum -= dwCode;
+        }
+    }
+    results.push_back({ L"parse.parsenumber", getMilliseconds(start) * 1000000.0 / ((double)iterations * inputs.size()), L"ns/op" });
+    results.push_back({ L"parse.checksum", (double)dwChecksum, L"value" });
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchTranslate
+
+  Summary:  Measure TranslateEngine::translate for a realistic code mix.
+            The first pass fills the message cache.
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+            int iterations
+              Passes over all codes
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void benchTranslate(std::vector<BenchResult>& results, int iterations) {
+    std::vector<DWORD> codes;
+    createCodeMix(codes);
+    TranslateEngine* pEngine = new TranslateEngine(); // Too large for the stack
+    ResultListSink sink;
+    size_t count = 0;
+
+    LONGLONG start = getTimestamp();
+    for (DWORD dwCode : codes) {
+        sink.clear();
+        count += pEngine->translate(dwCode, sink);
+    }
+    results.push_back({ L"translate.firstpass", getMilliseconds(start) * 1000000.0 / codes.size(), L"ns/op" });
+
+    start = getTimestamp();
+    for (int i = 0; i < iterations; i++) {
+        for (DWORD dwCode : codes) {
+            sink.clear();
+            count += pEngine->translate(dwCode, sink);
+        }
+    }
+    double ms = getMilliseconds(start);
+    results.push_back({ L"translate.mix", ms * 1000000.0 / ((double)iterations * codes.size()), L"ns/op" });
+    results.push_back({ L"translate.throughput", ((double)iterations * codes.size()) / (ms / 1000.0), L"codes/s" });
+    results.push_back({ L"translate.results", (double)count / ((double)(iterations + 1) * codes.size()), L"results/code" });
+    delete pEngine;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: writeResults
+
+  Summary:  Write results to stdout
+
+  Args:     const std::vector<BenchResult>& results
+              Results
+            bool bJson
+              true = JSON, false = CSV
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void writeResults(const std::vector<BenchResult>& results, bool bJson) {
+    if (bJson) {
+        wprintf(L"[\n");
+        for (size_t i = 0; i < results.size(); i++) {
+            wprintf(L"  {\"name\":\"%ls\",\"value\":%.3f,\"unit\":\"%ls\"}%ls\n", results[i].sName.c_str(), results[i].value, results[i].szUnit, (i + 1 < results.size()) ? L"," : L"");
+        }
+        wprintf(L"]\n");
+    } else {
+        wprintf(L"name,value,unit\n");
+        for (const BenchResult& result : results) wprintf(L"%ls,%.3f,%ls\n", result.sName.c_str(), result.value, result.szUnit);
+    }
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: benchFormatTranslation
+
+  Summary:  Measure formatTranslation (output of the dialog) for a
+            realistic code mix. The length of each text must match its
+            zero terminated length, because SetDlgItemText stops at the
+            first NUL.
+
+  Args:     std::vector<BenchResult>& results
+              Receives the results
+            int iterations
+              Passes over all codes
+
+  Returns:  bool
+              false = A text contains a NUL
+
+-----------------------------------------------------------------F-F*/
+bool benchFormatTranslation(std::vector<BenchResult>& results, int iterations) {
+    std::vector<ULONGLONG> values;
+    std::vector<DWORD> codes;
+    createCodeMix(codes);
+    for (DWORD dwCode : codes) values.push_back(dwCode);
+    values.push_back(0x0000000100000000); // 64 bit value without 32 bit error code
+    TranslateEngine* pEngine = new TranslateEngine(); // Too large for the stack
+    wchar_t* pBuffer = new wchar_t[MAXTRANSLATIONLENGTH];
+    bool bOK = true;
+
+    // Text must not end before its length
+    for (ULONGLONG qwValue : values) {
+        TextBufferSink sink(pBuffer, MAXTRANSLATIONLENGTH);
+        formatTranslation(*pEngine, qwValue, SOURCEMASK_ALL, sink);
+        if (wcslen(sink.text()) != sink.length()) {
+            fwprintf(stderr, L"Output of formatTranslation contains a NUL for 0x%llX\n", qwValue);
+            bOK = false;
+            break;
+        }
+    }
+
+    if (bOK) {
+        size_t length = 0; // Prevents removing the loops by the optimizer
+        LONGLONG start = getTimestamp();
+        for (int i = 0; i < iterations; i++) {
+            for (ULONGLONG qwValue : values) {
+                TextBufferSink sink(pBuffer, MAXTRANSLATIONLENGTH);
+                formatTranslation(*pEngine, qwValue, SOURCEMASK_ALL, sink);
+                length += sink.length();
+            }
+        }
+        results.push_back({ L"translate.format", getMilliseconds(start) * 1000000.0 / ((double)iterations * values.size()), L"ns/op" });
+        results.push_back({ L"translate.format.chars", (double)length / ((double)iterations * values.size()), L"chars/code" });
+    }
+    delete[] pBuffer;
+    delete pEngine;
+    return bOK;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: wmain
+
+  Summary:  Run all benchmarks and write the results
+
+  Args:     int argc
+            wchar_t* argv[]
+              Command line arguments
+
+  Returns:  int
+              0 = success, 1 = invalid arguments, parser results differ from
+              StrToIntEx or the output of formatTranslation contains a NUL
+
+-----------------------------------------------------------------F-F*/
+int wmain(int argc, wchar_t* argv[]) {
+    int iterations = DEFAULTITERATIONS;
+    bool bJson = false;
+    for (int i = 1; i < argc; i++) {
+        if (_wcsicmp(argv[i], L"/format:json") == 0) bJson = true;
+        else if (_wcsicmp(argv[i], L"/format:csv") == 0) bJson = false;
+        else if ((_wcsnicmp(argv[i], L"/iterations:", 12) == 0) && StrToIntEx(argv[i] + 12, STIF_DEFAULT, &iterations) && (iterations >= 1)) continue;
+        else {
+            fwprintf(stderr, L"Usage: TranslateErrorCodeBench [/format:csv|json] [/iterations:N]\n");
+            return 1;
+        }
+    }
+
+    std::vector<BenchResult> results;
+    double memory = getPrivateBytes();
+    benchStartup(results); // Must be first, measures the first calls
+    benchFormatMessage(results);
+    benchLookups(results, iterations);
+    if (!benchParser(results, iterations)) return 1;
+    benchTranslate(results, iterations);
+    if (!benchFormatTranslation(results, iterations)) return 1;
+    benchProcessStart(results);
+    results.push_back({ L"memory.total", getPrivateBytes() - memory, L"KiB" });
+    writeResults(results, bJson);
+    return 0;
+}
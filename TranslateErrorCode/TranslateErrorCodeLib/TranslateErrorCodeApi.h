@@ -0,0 +1,53 @@
+#pragma once
+
+// C interface of TranslateErrorCodeLib.dll. The functions can be called
+// from any thread, each thread uses its own translation engine. The first
+// call of a thread allocates its engine (about 70 KB), the first FormatMessage
+// call of a thread its message cache (about 530 KB). Other calls do not
+// allocate memory.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#ifdef TRANSLATEERRORCODELIB_EXPORTS
+#define TEC_API __declspec(dllexport)
+#else
+#define TEC_API __declspec(dllimport)
+#endif
+
+// Calling convention (stdcall on x86, like the Win32 API)
+#define TEC_CALL __stdcall
+
+// Bits of the source mask
+#define TEC_SOURCE_WIN32    0x01 // Win32/HRESULT
+#define TEC_SOURCE_NTSTATUS 0x02 // NTSTATUS
+#define TEC_SOURCE_WU       0x04 // Windows Update
+#define TEC_SOURCE_LDAP     0x08 // LDAP
+#define TEC_SOURCE_BUGCHECK 0x10 // StopCode/BugCheck
+#define TEC_SOURCE_WININET  0x20 // Wininet
+#define TEC_SOURCE_ALL      0x3F
+
+// Return value for invalid arguments or when the engine could not be created
+#define TEC_ERROR ((size_t)-1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Translate an error code. The texts of all sources are written as lines
+// "Source: Text" (separated by "\r\n") zero terminated to buf.
+// Returns the length of the complete text in chars (without termination),
+// a text with length >= cap was truncated. 0 = Error code was not found.
+TEC_API size_t TEC_CALL TEC_Translate(uint32_t code, uint32_t sourcesMask, wchar_t* buf, size_t cap);
+
+// Translate count error codes. The zero terminated texts are written one
+// after another to buf, offsets[i] is the start of the text for codes[i].
+// Returns the number of translated codes. A result < count means, that
+// buf is full, continue with codes + result. TEC_ERROR = Invalid arguments
+// or the text of codes[0] does not fit into buf (use a larger buf).
+TEC_API size_t TEC_CALL TEC_TranslateBatch(const uint32_t* codes, size_t count, uint32_t sourcesMask, wchar_t* buf, size_t cap, size_t* offsets);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,208 @@
+﻿/*+===================================================================
+  File:      TranslateErrorCodeLib.cpp
+
+  Summary:   DLL with a C interface for the translation of error codes,
+             for example for P/Invoke from PowerShell:
+
+             Add-Type -Namespace TEC -Name Api -MemberDefinition '[DllImport("TranslateErrorCodeLib.dll", CharSet = CharSet.Unicode)] public static extern UIntPtr TEC_Translate(uint code, uint sourcesMask, System.Text.StringBuilder buf, UIntPtr cap);'
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "TranslateErrorCodeApi.h"
+#include "TranslateEngine.h"
+
+static_assert(TEC_SOURCE_WIN32 == SOURCEBIT(SOURCE_WIN32), "TEC_SOURCE_WIN32 does not match SOURCEBIT");
+static_assert(TEC_SOURCE_NTSTATUS == SOURCEBIT(SOURCE_NTSTATUS), "TEC_SOURCE_NTSTATUS does not match SOURCEBIT");
+static_assert(TEC_SOURCE_WU == SOURCEBIT(SOURCE_WU), "TEC_SOURCE_WU does not match SOURCEBIT");
+static_assert(TEC_SOURCE_LDAP == SOURCEBIT(SOURCE_LDAP), "TEC_SOURCE_LDAP does not match SOURCEBIT");
+static_assert(TEC_SOURCE_BUGCHECK == SOURCEBIT(SOURCE_BUGCHECK), "TEC_SOURCE_BUGCHECK does not match SOURCEBIT");
+static_assert(TEC_SOURCE_WININET == SOURCEBIT(SOURCE_WININET), "TEC_SOURCE_WININET does not match SOURCEBIT");
+static_assert(TEC_SOURCE_ALL == SOURCEMASK_ALL, "TEC_SOURCE_ALL does not match SOURCEMASK_ALL");
+
+// TLS slot for the engine of each thread
+DWORD g_dwEngineTlsIndex = TLS_OUT_OF_INDEXES;
+
+/*C+C+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Class:    ApiTextSink
+
+  Summary:  Sink writing the results as lines "Source: Text" to a caller
+            provided buffer. Counts the length of the complete text, also
+            when the buffer is too small.
+-----------------------------------------------------------------C-C*/
+class ApiTextSink : public OutputSink {
+public:
+    ApiTextSink(wchar_t* pBuffer, size_t capacity) : m_pBuffer(pBuffer), m_capacity(capacity) {
+        if (m_capacity > 0) m_pBuffer[0] = L'\0';
+    }
+    void addResult(const SourceResult& result) override {
+        if (m_length > 0) append(L"\r\n", 2);
+        const wchar_t* szName = getSourceName(result.source);
+        append(szName, wcslen(szName));
+        append(L": ", 2);
+        append(result.szText, result.length);
+    }
+    size_t length() const { return m_length; }
+private:
+    void append(const wchar_t* pText, size_t length) {
+        if (m_length + 1 < m_capacity) {
+            size_t copy = m_capacity - m_length - 1;
+            if (copy > length) copy = length;
+            wmemcpy(m_pBuffer + m_length, pText, copy);
+            m_pBuffer[m_length + copy] = L'\0';
+        }
+        m_length += length;
+    }
+    wchar_t* m_pBuffer;
+    size_t m_capacity;
+    size_t m_length = 0;
+};
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getThreadEngine
+
+  Summary:  Get engine of the calling thread, the engine is created on
+            the first call of the thread
+
+  Args:
+
+  Returns:  TranslateEngine*
+              Engine or NULL, if the TLS slot does not exist
+
+-----------------------------------------------------------------F-F*/
+TranslateEngine* getThreadEngine() {
+    if (g_dwEngineTlsIndex == TLS_OUT_OF_INDEXES) return NULL;
+    TranslateEngine* pEngine = (TranslateEngine*)TlsGetValue(g_dwEngineTlsIndex);
+    if (pEngine == NULL) {
+        pEngine = new TranslateEngine(); // Released in DllMain, when the thread ends
+        if (!TlsSetValue(g_dwEngineTlsIndex, pEngine)) {
+            delete pEngine;
+            return NULL;
+        }
+    }
+    return pEngine;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: releaseThreadEngine
+
+  Summary:  Release engine of the calling thread
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void releaseThreadEngine() {
+    if (g_dwEngineTlsIndex == TLS_OUT_OF_INDEXES) return;
+    TranslateEngine* pEngine = (TranslateEngine*)TlsGetValue(g_dwEngineTlsIndex);
+    if (pEngine == NULL) return;
+    TlsSetValue(g_dwEngineTlsIndex, NULL);
+    delete pEngine;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: DllMain
+
+  Summary:  DLL entry, manages the TLS slot for the engines and the ETW
+            provider
+
+  Args:     HMODULE hModule
+            DWORD dwReason
+            LPVOID lpReserved
+
+  Returns:  BOOL
+              TRUE = success
+
+-----------------------------------------------------------------F-F*/
+BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReason, LPVOID lpReserved) {
+    UNREFERENCED_PARAMETER(hModule);
+    switch (dwReason) {
+        case DLL_PROCESS_ATTACH:
+            g_dwEngineTlsIndex = TlsAlloc();
+            if (g_dwEngineTlsIndex == TLS_OUT_OF_INDEXES) return FALSE;
+            registerTraceProvider(); // Lookup events for ETW sessions
+            return TRUE;
+        case DLL_THREAD_DETACH:
+            releaseThreadEngine();
+            break;
+        case DLL_PROCESS_DETACH:
+            if (lpReserved != NULL) break; // Process ends, the memory is released anyway
+            // FreeLibrary: Engines of other still running threads are not released
+            releaseThreadEngine();
+            TlsFree(g_dwEngineTlsIndex);
+            g_dwEngineTlsIndex = TLS_OUT_OF_INDEXES;
+            unregisterTraceProvider(); // Required before the DLL is unloaded
+            break;
+    }
+    return TRUE;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TEC_Translate
+
+  Summary:  Translate error code to the texts of the selected sources
+
+  Args:     uint32_t code
+              Error code
+            uint32_t sourcesMask
+              Sources to search (TEC_SOURCE_...)
+            wchar_t* buf
+              Buffer for the text (can be NULL, when cap is 0)
+            size_t cap
+              Size of buf in chars (incl. termination)
+
+  Returns:  size_t
+              Length of the complete text, TEC_ERROR = error
+
+-----------------------------------------------------------------F-F*/
+TEC_API size_t TEC_CALL TEC_Translate(uint32_t code, uint32_t sourcesMask, wchar_t* buf, size_t cap) {
+    if ((buf == NULL) && (cap > 0)) return TEC_ERROR;
+    TranslateEngine* pEngine = getThreadEngine();
+    if (pEngine == NULL) return TEC_ERROR;
+    ApiTextSink sink(buf, cap);
+    pEngine->translate(code, sink, sourcesMask & SOURCEMASK_ALL);
+    return sink.length();
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: TEC_TranslateBatch
+
+  Summary:  Translate error codes to the texts of the selected sources
+
+  Args:     const uint32_t* codes
+              Error codes
+            size_t count
+              Number of error codes
+            uint32_t sourcesMask
+              Sources to search (TEC_SOURCE_...)
+            wchar_t* buf
+              Buffer for the texts (can be NULL, when cap is 0)
+            size_t cap
+              Size of buf in chars
+            size_t* offsets
+              Array with count elements for the start of each text in buf
+
+  Returns:  size_t
+              Number of translated error codes, TEC_ERROR = error or the
+              text of the first code does not fit into buf
+
+-----------------------------------------------------------------F-F*/
+TEC_API size_t TEC_CALL TEC_TranslateBatch(const uint32_t* codes, size_t count, uint32_t sourcesMask, wchar_t* buf, size_t cap, size_t* offsets) {
+    if (((codes == NULL) || (offsets == NULL)) && (count > 0)) return TEC_ERROR;
+    if ((buf == NULL) && (cap > 0)) return TEC_ERROR;
+    TranslateEngine* pEngine = getThreadEngine();
+    if (pEngine == NULL) return TEC_ERROR;
+    size_t used = 0;
+    for (size_t i = 0; i < count; i++) {
+        ApiTextSink sink(buf + used, cap - used);
+        pEngine->translate(codes[i], sink, sourcesMask & SOURCEMASK_ALL);
+        if (used + sink.length() >= cap) return (i > 0) ? i : TEC_ERROR; // Text does not fit, no progress for the first code
+        offsets[i] = used;
+        used += sink.length() + 1;
+    }
+    return count;
+}
@@ -0,0 +1,191 @@
+﻿/*+===================================================================
+  File:      WorkStealingPool.cpp
+
+  Summary:   Thread pool for the parallel batch mode. Each worker has its
+             own task queue, idle workers steal tasks from the other queues.
+
+  License: CC0
+  Copyright (c) 2024 codingABI
+
+===================================================================+*/
+
+#include "framework.h"
+#include "WorkStealingPool.h"
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: getDefaultThreadCount
+
+  Summary:  Get number of logical processors (of all processor groups)
+
+  Args:
+
+  Returns:  size_t
+
+-----------------------------------------------------------------F-F*/
+size_t getDefaultThreadCount() {
+    DWORD dwCount = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+    if (dwCount == 0) dwCount = 1;
+    if (dwCount > MAXWORKERTHREADS) dwCount = MAXWORKERTHREADS;
+    return dwCount;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::start
+
+  Summary:  Start worker threads
+
+  Args:     size_t threads
+              Number of threads (1 ... MAXWORKERTHREADS)
+
+  Returns:  bool
+              true = success
+
+-----------------------------------------------------------------F-F*/
+bool WorkStealingPool::start(size_t threads) {
+    if (!m_workers.empty() || (threads == 0) || (threads > MAXWORKERTHREADS)) return false;
+    m_hSemaphore = CreateSemaphore(NULL, 0, MAXLONG, NULL);
+    if (m_hSemaphore == NULL) return false;
+    m_lStop = 0;
+    m_nextWorker = 0;
+    for (size_t i = 0; i < threads; i++) {
+        Worker* pWorker = new Worker();
+        pWorker->pPool = this;
+        pWorker->index = i;
+        InitializeSRWLock(&pWorker->lock);
+        m_workers.push_back(pWorker);
+    }
+    // Start threads after all queues exist, because workers access all queues
+    for (Worker* pWorker : m_workers) {
+        pWorker->hThread = CreateThread(NULL, 0, threadProc, pWorker, 0, NULL);
+        if (pWorker->hThread == NULL) {
+            stop();
+            return false;
+        }
+    }
+    return true;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::stop
+
+  Summary:  Stop worker threads after all queued tasks are done
+
+  Args:
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void WorkStealingPool::stop() {
+    if (m_workers.empty()) return;
+    InterlockedExchange(&m_lStop, 1);
+    ReleaseSemaphore(m_hSemaphore, (LONG)m_workers.size(), NULL); // Wake up all workers
+    for (Worker* pWorker : m_workers) {
+        if (pWorker->hThread != NULL) {
+            WaitForSingleObject(pWorker->hThread, INFINITE);
+            CloseHandle(pWorker->hThread);
+        }
+    }
+    for (Worker* pWorker : m_workers) delete pWorker;
+    m_workers.clear();
+    CloseHandle(m_hSemaphore);
+    m_hSemaphore = NULL;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::submit
+
+  Summary:  Queue task (round robin to the worker queues). Must be called
+            from one thread only.
+
+  Args:     PoolTask* pTask
+              Task, must be valid until it has run
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void WorkStealingPool::submit(PoolTask* pTask) {
+    Worker* pWorker = m_workers[m_nextWorker];
+    m_nextWorker = (m_nextWorker + 1) % m_workers.size();
+    AcquireSRWLockExclusive(&pWorker->lock);
+    pWorker->tasks.push_back(pTask);
+    ReleaseSRWLockExclusive(&pWorker->lock);
+    ReleaseSemaphore(m_hSemaphore, 1, NULL);
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::takeTask
+
+  Summary:  Get newest task from own queue or oldest task from another queue
+
+  Args:     size_t index
+              Index of the calling worker
+
+  Returns:  PoolTask*
+              Task or NULL, if all queues are empty
+
+-----------------------------------------------------------------F-F*/
+PoolTask* WorkStealingPool::takeTask(size_t index) {
+    PoolTask* pTask = NULL;
+    Worker* pOwn = m_workers[index];
+    AcquireSRWLockExclusive(&pOwn->lock);
+    if (!pOwn->tasks.empty()) {
+        pTask = pOwn->tasks.back();
+        pOwn->tasks.pop_back();
+    }
+    ReleaseSRWLockExclusive(&pOwn->lock);
+    if (pTask != NULL) return pTask;
+
+    // Steal
+    for (size_t i = 1; (i < m_workers.size()) && (pTask == NULL); i++) {
+        Worker* pVictim = m_workers[(index + i) % m_workers.size()];
+        AcquireSRWLockExclusive(&pVictim->lock);
+        if (!pVictim->tasks.empty()) {
+            pTask = pVictim->tasks.front();
+            pVictim->tasks.pop_front();
+        }
+        ReleaseSRWLockExclusive(&pVictim->lock);
+    }
+    return pTask;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::threadProc
+
+  Summary:  Worker thread entry
+
+  Args:     LPVOID lpParameter
+              Worker*
+
+  Returns:  DWORD
+
+-----------------------------------------------------------------F-F*/
+DWORD WINAPI WorkStealingPool::threadProc(LPVOID lpParameter) {
+    Worker* pWorker = (Worker*)lpParameter;
+    pWorker->pPool->run(*pWorker);
+    return 0;
+}
+
+/*F+F+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+  Function: WorkStealingPool::run
+
+  Summary:  Run tasks until the pool is stopped and all queues are empty
+
+  Args:     Worker& worker
+              Worker of this thread
+
+  Returns:
+
+-----------------------------------------------------------------F-F*/
+void WorkStealingPool::run(Worker& worker) {
+    for (;;) {
+        WaitForSingleObject(m_hSemaphore, INFINITE);
+        // Each semaphore count belongs to one task, but the task can be
+        // in any queue or already taken by a worker without waiting
+        PoolTask* pTask = takeTask(worker.index);
+        if (pTask != NULL) {
+            pTask->run(worker.index);
+            continue;
+        }
+        if (m_lStop != 0) break;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "framework.h"
+#include <deque>
+#include <vector>
+
+// Max number of worker threads
+#define MAXWORKERTHREADS 256
+
+// Work item for the pool
+class PoolTask {
+public:
+    virtual ~PoolTask() {}
+    virtual void run(size_t worker) = 0; // worker = Index of the executing thread (0 ... threads - 1)
+};
+
+// Thread pool with one task queue per worker. Workers take their newest
+// task first and steal the oldest task from other workers, when their
+// own queue is empty.
+class WorkStealingPool {
+public:
+    WorkStealingPool() {}
+    ~WorkStealingPool() { stop(); }
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    bool start(size_t threads);
+    void stop();
+    void submit(PoolTask* pTask);
+    size_t threads() const { return m_workers.size(); }
+private:
+    struct Worker {
+        WorkStealingPool* pPool;
+        size_t index;
+        HANDLE hThread;
+        SRWLOCK lock;
+        std::deque<PoolTask*> tasks;
+    };
+    static DWORD WINAPI threadProc(LPVOID lpParameter);
+    void run(Worker& worker);
+    PoolTask* takeTask(size_t index);
+    std::vector<Worker*> m_workers;
+    HANDLE m_hSemaphore = NULL; // Count of queued tasks
+    size_t m_nextWorker = 0;
+    volatile LONG m_lStop = 0;
+};
+
+size_t getDefaultThreadCount();
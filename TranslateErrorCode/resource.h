@@ -7,10 +7,27 @@
 #define IDS_INPUTHINT                   104
 #define IDS_BUTTONTOOLTIP               105
 #define IDS_INPUTTOOLTIP                106
+#define IDS_NOSEARCHRESULTS             107
+#define IDS_TRAYTOOLTIP                 108
+#define IDS_TRAYOPEN                    109
+#define IDS_TRAYEXIT                    110
+#define IDS_HISTORYHINT                 111
 #define IDC_OUTPUT                      1004
 #define IDC_BUTTONSEARCH                1006
 #define IDC_INPUT                       1007
 #define IDC_GITHUBLINK                  1010
+#define IDC_SEARCHTEXT                  1011
+#define IDC_LIVE                        1012
+#define IDC_HISTORY                     1013
+#define IDC_CLIPBOARD                   1014
+#define IDC_SOURCEWIN32                 1015
+#define IDC_SOURCENTSTATUS              1016
+#define IDC_SOURCEWU                    1017
+#define IDC_SOURCELDAP                  1018
+#define IDC_SOURCEBUGCHECK              1019
+#define IDC_SOURCEWININET               1020
+#define IDM_TRAYOPEN                    32771
+#define IDM_TRAYEXIT                    32772
 #define IDC_STATIC                      -1
 
 // Next default values for new objects
@@ -19,8 +36,8 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NO_MFC                     1
 #define _APS_NEXT_RESOURCE_VALUE        129
-#define _APS_NEXT_COMMAND_VALUE         32771
-#define _APS_NEXT_CONTROL_VALUE         1011
-#define _APS_NEXT_SYMED_VALUE           110
+#define _APS_NEXT_COMMAND_VALUE         32773
+#define _APS_NEXT_CONTROL_VALUE         1021
+#define _APS_NEXT_SYMED_VALUE           112
 #endif
 #endif